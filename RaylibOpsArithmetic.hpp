@@ -0,0 +1,1074 @@
+#ifndef RAYLIBOPS_ARITHMETIC_HPP_INCLUDED
+#define RAYLIBOPS_ARITHMETIC_HPP_INCLUDED
+#include "RaylibOpsConfig.hpp"
+#include <stdexcept> //For divide-by-zero error trapping
+
+// **************************************************************
+//
+//      C++ Operator Overloads for RayLib: arithmetic
+//
+// **************************************************************
+//
+// The SIMD layer and the arithmetic operators on vectors, matrices, colors, rectangles, bounding boxes and rays.  Needs neither iostream nor raygui.
+
+// **************************************
+//
+// SIMD SUPPORT
+//
+// **************************************
+//
+// A thin layer over the intrinsics so that each batched kernel is written once.  Floats holds FloatWidth lanes: 8 with AVX, 4 with SSE2 or NEON, 1 otherwise.
+// Loads and stores are unaligned, so the kernels accept any pointer.  The containers below align their storage anyway.
+
+#if !defined(DISABLE_SIMD) && defined(__AVX__)
+#define RAYLIBOPS_SIMD_AVX
+#include <immintrin.h>
+#elif !defined(DISABLE_SIMD) && (defined(__SSE2__) || defined(_M_X64))
+#define RAYLIBOPS_SIMD_SSE
+#include <emmintrin.h>
+#elif !defined(DISABLE_SIMD) && defined(__ARM_NEON)
+#define RAYLIBOPS_SIMD_NEON
+#include <arm_neon.h>
+#endif
+#include <cmath>
+
+namespace RaylibOps {
+namespace Simd {
+
+#if defined(RAYLIBOPS_SIMD_AVX)
+typedef __m256 Floats;
+const int FloatWidth=8;
+inline Floats Load(const float* p) { return _mm256_loadu_ps(p); }
+inline void Store(float* p, Floats v) { _mm256_storeu_ps(p,v); }
+inline Floats Splat(float f) { return _mm256_set1_ps(f); }
+inline Floats Add(Floats a, Floats b) { return _mm256_add_ps(a,b); }
+inline Floats Subtract(Floats a, Floats b) { return _mm256_sub_ps(a,b); }
+inline Floats Multiply(Floats a, Floats b) { return _mm256_mul_ps(a,b); }
+inline Floats Abs(Floats a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f),a); }
+inline Floats Min(Floats a, Floats b) { return _mm256_min_ps(a,b); }
+inline Floats Max(Floats a, Floats b) { return _mm256_max_ps(a,b); }
+inline Floats Divide(Floats a, Floats b) { return _mm256_div_ps(a,b); }
+inline Floats Sqrt(Floats a) { return _mm256_sqrt_ps(a); }
+inline Floats FlipSign(Floats a, Floats s) { return _mm256_xor_ps(a,_mm256_and_ps(s,_mm256_set1_ps(-0.0f))); }  //a negated in the lanes where s has its sign bit set
+inline unsigned int LessEqualBits(Floats a, Floats b) { return (unsigned int)_mm256_movemask_ps(_mm256_cmp_ps(a,b,_CMP_LE_OQ)); }  //Bit k set if lane k of a<=b
+//Loads FloatWidth groups of 4 floats (e.g. quaternions) and transposes them, so x holds every first float, y every second, etc.  StoreQuads undoes it.
+inline void LoadQuads(const float* p, Floats& x, Floats& y, Floats& z, Floats& w) {
+    __m128 a0=_mm_loadu_ps(p), a1=_mm_loadu_ps(p+4), a2=_mm_loadu_ps(p+8), a3=_mm_loadu_ps(p+12);
+    __m128 b0=_mm_loadu_ps(p+16), b1=_mm_loadu_ps(p+20), b2=_mm_loadu_ps(p+24), b3=_mm_loadu_ps(p+28);
+    _MM_TRANSPOSE4_PS(a0,a1,a2,a3);
+    _MM_TRANSPOSE4_PS(b0,b1,b2,b3);
+    x=_mm256_insertf128_ps(_mm256_castps128_ps256(a0),b0,1);
+    y=_mm256_insertf128_ps(_mm256_castps128_ps256(a1),b1,1);
+    z=_mm256_insertf128_ps(_mm256_castps128_ps256(a2),b2,1);
+    w=_mm256_insertf128_ps(_mm256_castps128_ps256(a3),b3,1);
+}
+inline void StoreQuads(float* p, Floats x, Floats y, Floats z, Floats w) {
+    __m128 a0=_mm256_castps256_ps128(x), a1=_mm256_castps256_ps128(y), a2=_mm256_castps256_ps128(z), a3=_mm256_castps256_ps128(w);
+    __m128 b0=_mm256_extractf128_ps(x,1), b1=_mm256_extractf128_ps(y,1), b2=_mm256_extractf128_ps(z,1), b3=_mm256_extractf128_ps(w,1);
+    _MM_TRANSPOSE4_PS(a0,a1,a2,a3);
+    _MM_TRANSPOSE4_PS(b0,b1,b2,b3);
+    _mm_storeu_ps(p,a0); _mm_storeu_ps(p+4,a1); _mm_storeu_ps(p+8,a2); _mm_storeu_ps(p+12,a3);
+    _mm_storeu_ps(p+16,b0); _mm_storeu_ps(p+20,b1); _mm_storeu_ps(p+24,b2); _mm_storeu_ps(p+28,b3);
+}
+#elif defined(RAYLIBOPS_SIMD_SSE)
+typedef __m128 Floats;
+const int FloatWidth=4;
+inline Floats Load(const float* p) { return _mm_loadu_ps(p); }
+inline void Store(float* p, Floats v) { _mm_storeu_ps(p,v); }
+inline Floats Splat(float f) { return _mm_set1_ps(f); }
+inline Floats Add(Floats a, Floats b) { return _mm_add_ps(a,b); }
+inline Floats Subtract(Floats a, Floats b) { return _mm_sub_ps(a,b); }
+inline Floats Multiply(Floats a, Floats b) { return _mm_mul_ps(a,b); }
+inline Floats Abs(Floats a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f),a); }
+inline Floats Min(Floats a, Floats b) { return _mm_min_ps(a,b); }
+inline Floats Max(Floats a, Floats b) { return _mm_max_ps(a,b); }
+inline Floats Divide(Floats a, Floats b) { return _mm_div_ps(a,b); }
+inline Floats Sqrt(Floats a) { return _mm_sqrt_ps(a); }
+inline Floats FlipSign(Floats a, Floats s) { return _mm_xor_ps(a,_mm_and_ps(s,_mm_set1_ps(-0.0f))); }  //a negated in the lanes where s has its sign bit set
+inline unsigned int LessEqualBits(Floats a, Floats b) { return (unsigned int)_mm_movemask_ps(_mm_cmple_ps(a,b)); }  //Bit k set if lane k of a<=b
+//Loads FloatWidth groups of 4 floats (e.g. quaternions) and transposes them, so x holds every first float, y every second, etc.  StoreQuads undoes it.
+inline void LoadQuads(const float* p, Floats& x, Floats& y, Floats& z, Floats& w) {
+    x=_mm_loadu_ps(p); y=_mm_loadu_ps(p+4); z=_mm_loadu_ps(p+8); w=_mm_loadu_ps(p+12);
+    _MM_TRANSPOSE4_PS(x,y,z,w);
+}
+inline void StoreQuads(float* p, Floats x, Floats y, Floats z, Floats w) {
+    _MM_TRANSPOSE4_PS(x,y,z,w);
+    _mm_storeu_ps(p,x); _mm_storeu_ps(p+4,y); _mm_storeu_ps(p+8,z); _mm_storeu_ps(p+12,w);
+}
+#elif defined(RAYLIBOPS_SIMD_NEON)
+typedef float32x4_t Floats;
+const int FloatWidth=4;
+inline Floats Load(const float* p) { return vld1q_f32(p); }
+inline void Store(float* p, Floats v) { vst1q_f32(p,v); }
+inline Floats Splat(float f) { return vdupq_n_f32(f); }
+inline Floats Add(Floats a, Floats b) { return vaddq_f32(a,b); }
+inline Floats Subtract(Floats a, Floats b) { return vsubq_f32(a,b); }
+inline Floats Multiply(Floats a, Floats b) { return vmulq_f32(a,b); }
+inline Floats Abs(Floats a) { return vabsq_f32(a); }
+inline Floats Min(Floats a, Floats b) { return vminq_f32(a,b); }
+inline Floats Max(Floats a, Floats b) { return vmaxq_f32(a,b); }
+inline Floats Divide(Floats a, Floats b) { return vdivq_f32(a,b); }
+inline Floats Sqrt(Floats a) { return vsqrtq_f32(a); }
+inline Floats FlipSign(Floats a, Floats s) { return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(a),vandq_u32(vreinterpretq_u32_f32(s),vdupq_n_u32(0x80000000u)))); }  //a negated in the lanes where s has its sign bit set
+inline unsigned int MaskBits(uint32x4_t m) { return (vgetq_lane_u32(m,0)&1u) | (vgetq_lane_u32(m,1)&2u) | (vgetq_lane_u32(m,2)&4u) | (vgetq_lane_u32(m,3)&8u); }
+inline unsigned int LessEqualBits(Floats a, Floats b) { return MaskBits(vcleq_f32(a,b)); }  //Bit k set if lane k of a<=b
+//Loads FloatWidth groups of 4 floats (e.g. quaternions) and transposes them, so x holds every first float, y every second, etc.  StoreQuads undoes it.
+inline void LoadQuads(const float* p, Floats& x, Floats& y, Floats& z, Floats& w) {
+    float32x4x4_t q=vld4q_f32(p);
+    x=q.val[0]; y=q.val[1]; z=q.val[2]; w=q.val[3];
+}
+inline void StoreQuads(float* p, Floats x, Floats y, Floats z, Floats w) {
+    float32x4x4_t q;
+    q.val[0]=x; q.val[1]=y; q.val[2]=z; q.val[3]=w;
+    vst4q_f32(p,q);
+}
+#else
+typedef float Floats;
+const int FloatWidth=1;
+inline Floats Load(const float* p) { return *p; }
+inline void Store(float* p, Floats v) { *p=v; }
+inline Floats Splat(float f) { return f; }
+inline Floats Add(Floats a, Floats b) { return a+b; }
+inline Floats Subtract(Floats a, Floats b) { return a-b; }
+inline Floats Multiply(Floats a, Floats b) { return a*b; }
+inline Floats Abs(Floats a) { return std::fabs(a); }
+inline Floats Min(Floats a, Floats b) { return (a<b)?a:b; }
+inline Floats Max(Floats a, Floats b) { return (a>b)?a:b; }
+inline Floats Divide(Floats a, Floats b) { return a/b; }
+inline Floats Sqrt(Floats a) { return std::sqrt(a); }
+inline Floats FlipSign(Floats a, Floats s) { return a*std::copysign(1.0f,s); }
+inline unsigned int LessEqualBits(Floats a, Floats b) { return (a<=b)?1u:0u; }
+inline void LoadQuads(const float* p, Floats& x, Floats& y, Floats& z, Floats& w) { x=p[0]; y=p[1]; z=p[2]; w=p[3]; }
+inline void StoreQuads(float* p, Floats x, Floats y, Floats z, Floats w) { p[0]=x; p[1]=y; p[2]=z; p[3]=w; }
+#endif
+
+// Bytes holds ByteWidth unsigned chars, i.e. ByteWidth/4 Colors: 32 bytes with AVX2, 16 with SSE2 or NEON.  Used by the batched Color operations.
+#if defined(RAYLIBOPS_SIMD_AVX) && defined(__AVX2__)
+#define RAYLIBOPS_SIMD_BYTES
+typedef __m256i Bytes;
+const int ByteWidth=32;
+inline Bytes LoadBytes(const void* p) { return _mm256_loadu_si256((const __m256i*)p); }
+inline void StoreBytes(void* p, Bytes v) { _mm256_storeu_si256((__m256i*)p,v); }
+inline Bytes SplatWord(unsigned int w) { return _mm256_set1_epi32((int)w); }
+inline Bytes AddSaturate(Bytes a, Bytes b) { return _mm256_adds_epu8(a,b); }
+inline Bytes SubtractSaturate(Bytes a, Bytes b) { return _mm256_subs_epu8(a,b); }
+inline Bytes MultiplySaturate(Bytes a, Bytes b) {  //Widen to 16 bits, multiply, then min(p,255) computed as p-max(p-255,0)
+    __m256i zero=_mm256_setzero_si256(), max=_mm256_set1_epi16(255);
+    __m256i lo=_mm256_mullo_epi16(_mm256_unpacklo_epi8(a,zero),_mm256_unpacklo_epi8(b,zero));
+    __m256i hi=_mm256_mullo_epi16(_mm256_unpackhi_epi8(a,zero),_mm256_unpackhi_epi8(b,zero));
+    lo=_mm256_sub_epi16(lo,_mm256_subs_epu16(lo,max));
+    hi=_mm256_sub_epi16(hi,_mm256_subs_epu16(hi,max));
+return _mm256_packus_epi16(lo,hi);
+}
+inline Bytes MultiplyNormalized(Bytes a, Bytes b) {  //x=a*b+127, then x/255 as (x+(x>>8)+1)>>8, which is exact for every a, b
+    __m256i zero=_mm256_setzero_si256(), bias=_mm256_set1_epi16(127), one=_mm256_set1_epi16(1);
+    __m256i lo=_mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(a,zero),_mm256_unpacklo_epi8(b,zero)),bias);
+    __m256i hi=_mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(a,zero),_mm256_unpackhi_epi8(b,zero)),bias);
+    lo=_mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(lo,_mm256_srli_epi16(lo,8)),one),8);
+    hi=_mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(hi,_mm256_srli_epi16(hi,8)),one),8);
+return _mm256_packus_epi16(lo,hi);
+}
+#elif defined(RAYLIBOPS_SIMD_AVX) || defined(RAYLIBOPS_SIMD_SSE)
+#define RAYLIBOPS_SIMD_BYTES
+typedef __m128i Bytes;
+const int ByteWidth=16;
+inline Bytes LoadBytes(const void* p) { return _mm_loadu_si128((const __m128i*)p); }
+inline void StoreBytes(void* p, Bytes v) { _mm_storeu_si128((__m128i*)p,v); }
+inline Bytes SplatWord(unsigned int w) { return _mm_set1_epi32((int)w); }
+inline Bytes AddSaturate(Bytes a, Bytes b) { return _mm_adds_epu8(a,b); }
+inline Bytes SubtractSaturate(Bytes a, Bytes b) { return _mm_subs_epu8(a,b); }
+inline Bytes MultiplySaturate(Bytes a, Bytes b) {  //Widen to 16 bits, multiply, then min(p,255) computed as p-max(p-255,0)
+    __m128i zero=_mm_setzero_si128(), max=_mm_set1_epi16(255);
+    __m128i lo=_mm_mullo_epi16(_mm_unpacklo_epi8(a,zero),_mm_unpacklo_epi8(b,zero));
+    __m128i hi=_mm_mullo_epi16(_mm_unpackhi_epi8(a,zero),_mm_unpackhi_epi8(b,zero));
+    lo=_mm_sub_epi16(lo,_mm_subs_epu16(lo,max));
+    hi=_mm_sub_epi16(hi,_mm_subs_epu16(hi,max));
+return _mm_packus_epi16(lo,hi);
+}
+inline Bytes MultiplyNormalized(Bytes a, Bytes b) {  //x=a*b+127, then x/255 as (x+(x>>8)+1)>>8, which is exact for every a, b
+    __m128i zero=_mm_setzero_si128(), bias=_mm_set1_epi16(127), one=_mm_set1_epi16(1);
+    __m128i lo=_mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(a,zero),_mm_unpacklo_epi8(b,zero)),bias);
+    __m128i hi=_mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(a,zero),_mm_unpackhi_epi8(b,zero)),bias);
+    lo=_mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(lo,_mm_srli_epi16(lo,8)),one),8);
+    hi=_mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(hi,_mm_srli_epi16(hi,8)),one),8);
+return _mm_packus_epi16(lo,hi);
+}
+#elif defined(RAYLIBOPS_SIMD_NEON)
+#define RAYLIBOPS_SIMD_BYTES
+typedef uint8x16_t Bytes;
+const int ByteWidth=16;
+inline Bytes LoadBytes(const void* p) { return vld1q_u8((const uint8_t*)p); }
+inline void StoreBytes(void* p, Bytes v) { vst1q_u8((uint8_t*)p,v); }
+inline Bytes SplatWord(unsigned int w) { return vreinterpretq_u8_u32(vdupq_n_u32(w)); }
+inline Bytes AddSaturate(Bytes a, Bytes b) { return vqaddq_u8(a,b); }
+inline Bytes SubtractSaturate(Bytes a, Bytes b) { return vqsubq_u8(a,b); }
+inline Bytes MultiplySaturate(Bytes a, Bytes b) {  //Widening multiply, then saturating narrow
+    uint16x8_t lo=vmull_u8(vget_low_u8(a),vget_low_u8(b));
+    uint16x8_t hi=vmull_u8(vget_high_u8(a),vget_high_u8(b));
+return vcombine_u8(vqmovn_u16(lo),vqmovn_u16(hi));
+}
+inline Bytes MultiplyNormalized(Bytes a, Bytes b) {  //x=a*b+127, then x/255 as (x+(x>>8)+1)>>8, which is exact for every a, b
+    uint16x8_t bias=vdupq_n_u16(127);
+    uint16x8_t lo=vaddq_u16(vmull_u8(vget_low_u8(a),vget_low_u8(b)),bias);
+    uint16x8_t hi=vaddq_u16(vmull_u8(vget_high_u8(a),vget_high_u8(b)),bias);
+    lo=vaddq_u16(vaddq_u16(lo,vshrq_n_u16(lo,8)),vdupq_n_u16(1));
+    hi=vaddq_u16(vaddq_u16(hi,vshrq_n_u16(hi,8)),vdupq_n_u16(1));
+return vcombine_u8(vshrn_n_u16(lo,8),vshrn_n_u16(hi,8));
+}
+#endif
+
+//The instruction set the kernels were compiled for, for labeling benchmark and test results
+#if defined(RAYLIBOPS_SIMD_AVX) && defined(__AVX2__)
+constexpr const char* BackendName="AVX2";
+#elif defined(RAYLIBOPS_SIMD_AVX)
+constexpr const char* BackendName="AVX";
+#elif defined(RAYLIBOPS_SIMD_SSE)
+constexpr const char* BackendName="SSE2";
+#elif defined(RAYLIBOPS_SIMD_NEON)
+constexpr const char* BackendName="NEON";
+#else
+constexpr const char* BackendName="scalar";
+#endif
+
+} // namespace Simd
+} // namespace RaylibOps
+
+// **************************************
+//
+// ARITHMETIC OVERLOADS
+//
+// **************************************
+//
+// Since Quaternion is a typedef of Vector4 in RayLib, Vector4 only gets the operators which work the same way on Quaternions as on regular vectors:
+// addition, subtraction, negation and scaling by a float.  For the quaternion product and the like use RaylibOps::Quat, a separate type with the layout of Vector4 (see QUATERNIONS below).
+
+// Generic vector core
+//
+// The vector operators are each written once, as templates over VectorTraits<V>, which gives the component type and a pointer to each member of V.
+// Componentwise<Op>() expands Op over the components with a parameter pack, so a+b on a Vector3 is exactly {a.x+b.x, a.y+b.y, a.z+b.z}: there is no loop to unroll,
+// and the compiler's vectorizer is free to combine the components into one SIMD instruction.  All of it is constexpr.
+// Besides raylib's Vector2, Vector3 and Vector4, RaylibOps::Vector2i, Vector3i and Vector4i hold int components for grid and tile coordinates, and get the same operators.
+// Their arithmetic stays in int, division truncates like int division, and their operator== is always exact.
+#include <type_traits>
+#include <utility>
+namespace RaylibOps {
+
+struct Vector2i { int x; int y; };
+struct Vector3i { int x; int y; int z; };
+struct Vector4i { int x; int y; int z; int w; };
+
+#ifdef VECTOR_EXPRESSION_TEMPLATES
+const bool VectorExpressionTemplates=true;
+#else
+const bool VectorExpressionTemplates=false;
+#endif
+
+//Scalar is the component type and Components[] points to each member in order.  Expressions is true when the +, - and float * are the expression templates of option C.
+//Other types have no members, which keeps the vector operators out of overload resolution for them.
+template<typename V> struct VectorTraits {};
+
+template<> struct VectorTraits<Vector2> {
+    typedef float Scalar;
+    static constexpr int Dimension=2;
+    static constexpr float Vector2::* Components[2]={&Vector2::x, &Vector2::y};
+    static constexpr bool Expressions=VectorExpressionTemplates;
+};
+
+template<> struct VectorTraits<Vector3> {
+    typedef float Scalar;
+    static constexpr int Dimension=3;
+    static constexpr float Vector3::* Components[3]={&Vector3::x, &Vector3::y, &Vector3::z};
+    static constexpr bool Expressions=VectorExpressionTemplates;
+};
+
+template<> struct VectorTraits<Vector4> {
+    typedef float Scalar;
+    static constexpr int Dimension=4;
+    static constexpr float Vector4::* Components[4]={&Vector4::x, &Vector4::y, &Vector4::z, &Vector4::w};
+    static constexpr bool Expressions=false;
+};
+
+template<> struct VectorTraits<Vector2i> {
+    typedef int Scalar;
+    static constexpr int Dimension=2;
+    static constexpr int Vector2i::* Components[2]={&Vector2i::x, &Vector2i::y};
+    static constexpr bool Expressions=false;
+};
+
+template<> struct VectorTraits<Vector3i> {
+    typedef int Scalar;
+    static constexpr int Dimension=3;
+    static constexpr int Vector3i::* Components[3]={&Vector3i::x, &Vector3i::y, &Vector3i::z};
+    static constexpr bool Expressions=false;
+};
+
+template<> struct VectorTraits<Vector4i> {
+    typedef int Scalar;
+    static constexpr int Dimension=4;
+    static constexpr int Vector4i::* Components[4]={&Vector4i::x, &Vector4i::y, &Vector4i::z, &Vector4i::w};
+    static constexpr bool Expressions=false;
+};
+
+//Return types which exist only for vectors (R for any vector, PlainVector<V> unless V uses expression templates, FloatVector and IntegerVector by component type)
+template<typename V, typename R=V> using AnyVector = typename std::enable_if<(VectorTraits<V>::Dimension>0), R>::type;
+template<typename V, typename R=V> using PlainVector = typename std::enable_if<!VectorTraits<V>::Expressions, R>::type;
+template<typename V, typename R=V> using FloatVector = typename std::enable_if<std::is_floating_point<typename VectorTraits<V>::Scalar>::value, R>::type;
+template<typename V, typename R=V> using IntegerVector = typename std::enable_if<std::is_integral<typename VectorTraits<V>::Scalar>::value, R>::type;
+
+//Simply V, but as a parameter type it does not take part in deducing V, so the argument may be anything which converts to V (e.g. an expression of option C)
+template<typename V> using VectorOperand = typename std::enable_if<true, V>::type;
+
+struct ComponentAdd { template<typename T> static constexpr T Apply(T a, T b) { return a+b; } };
+struct ComponentSubtract { template<typename T> static constexpr T Apply(T a, T b) { return a-b; } };
+struct ComponentMultiply { template<typename T> static constexpr T Apply(T a, T b) { return a*b; } };
+struct ComponentNegate { template<typename T> static constexpr T Apply(T a) { return -a; } };
+
+template<typename Op, typename V, std::size_t... I> constexpr V ComponentwiseExpand(const V& a, const V& b, std::index_sequence<I...>) {
+return V{Op::Apply(a.*VectorTraits<V>::Components[I], b.*VectorTraits<V>::Components[I])...};
+}
+
+template<typename Op, typename V, std::size_t... I> constexpr V ComponentwiseExpand(const V& a, typename VectorTraits<V>::Scalar s, std::index_sequence<I...>) {
+return V{Op::Apply(a.*VectorTraits<V>::Components[I], s)...};
+}
+
+template<typename Op, typename V, std::size_t... I> constexpr V ComponentwiseExpand(const V& a, std::index_sequence<I...>) {
+return V{Op::Apply(a.*VectorTraits<V>::Components[I])...};
+}
+
+template<typename Tolerance, typename V, std::size_t... I> constexpr bool AllComponentsExpand(const V& a, const V& b, std::index_sequence<I...>) {
+return (Tolerance::Equal(a.*VectorTraits<V>::Components[I], b.*VectorTraits<V>::Components[I]) & ...);  //& rather than &&, so there is no early exit to branch on
+}
+
+//Op::Apply(a,b) for each pair of components
+template<typename Op, typename V> constexpr AnyVector<V> Componentwise(const V& a, const V& b) {
+return ComponentwiseExpand<Op>(a,b,std::make_index_sequence<VectorTraits<V>::Dimension>());
+}
+
+//Op::Apply(a,s) for each component of a
+template<typename Op, typename V> constexpr AnyVector<V> Componentwise(const V& a, typename VectorTraits<V>::Scalar s) {
+return ComponentwiseExpand<Op>(a,s,std::make_index_sequence<VectorTraits<V>::Dimension>());
+}
+
+//Op::Apply(a) for each component
+template<typename Op, typename V> constexpr AnyVector<V> Componentwise(const V& a) {
+return ComponentwiseExpand<Op>(a,std::make_index_sequence<VectorTraits<V>::Dimension>());
+}
+
+//Whether Tolerance::Equal() holds for every pair of components
+template<typename Tolerance, typename V> constexpr AnyVector<V,bool> AllComponents(const V& a, const V& b) {
+return AllComponentsExpand<Tolerance>(a,b,std::make_index_sequence<VectorTraits<V>::Dimension>());
+}
+
+} // namespace RaylibOps
+
+#ifdef VECTOR_EXPRESSION_TEMPLATES
+// Expression templates for Vector2 and Vector3 (see option C in RaylibOpsConfig.hpp)
+//
+// Each operator returns a small node which records the operation and its operands.  Nothing is computed until the node is converted to a Vector2 or Vector3,
+// at which point get<0>(), get<1>() and get<2>() walk the whole tree for each component.  Component indices are template parameters, so the compiler unrolls everything.
+// The nodes are constexpr like the plain operators, so a constant expression may use them as long as it converts the result to a vector.
+#include <type_traits>
+namespace RaylibOps {
+
+template<int I> constexpr float Component(const Vector2& v) { return (I==0)?v.x:v.y; }
+template<int I> constexpr float Component(const Vector3& v) { return (I==0)?v.x:(I==1)?v.y:v.z; }
+
+//Base class of every expression node: provides the conversion which evaluates the expression
+template<typename E, typename V> struct VectorExpression;
+
+template<typename E> struct VectorExpression<E,Vector2> {
+    constexpr operator Vector2() const {
+        const E& e=static_cast<const E&>(*this);
+    return Vector2{e.template get<0>(), e.template get<1>()};
+    }
+};
+
+template<typename E> struct VectorExpression<E,Vector3> {
+    constexpr operator Vector3() const {
+        const E& e=static_cast<const E&>(*this);
+    return Vector3{e.template get<0>(), e.template get<1>(), e.template get<2>()};
+    }
+};
+
+//Leaf node: a reference to an actual Vector2 or Vector3
+template<typename V> struct VectorLeaf {
+    typedef V vector_type;
+    const V& v;
+    constexpr explicit VectorLeaf(const V& a) : v(a) {}
+    template<int I> constexpr float get() const { return Component<I>(v); }
+};
+
+template<typename L, typename R> struct VectorSum : VectorExpression<VectorSum<L,R>, typename L::vector_type> {
+    typedef typename L::vector_type vector_type;
+    L l;
+    R r;
+    constexpr VectorSum(const L& a, const R& b) : l(a), r(b) {}
+    template<int I> constexpr float get() const { return l.template get<I>()+r.template get<I>(); }
+};
+
+template<typename L, typename R> struct VectorDifference : VectorExpression<VectorDifference<L,R>, typename L::vector_type> {
+    typedef typename L::vector_type vector_type;
+    L l;
+    R r;
+    constexpr VectorDifference(const L& a, const R& b) : l(a), r(b) {}
+    template<int I> constexpr float get() const { return l.template get<I>()-r.template get<I>(); }
+};
+
+template<typename E> struct VectorScaled : VectorExpression<VectorScaled<E>, typename E::vector_type> {
+    typedef typename E::vector_type vector_type;
+    E e;
+    float s;
+    constexpr VectorScaled(const E& a, float b) : e(a), s(b) {}
+    template<int I> constexpr float get() const { return e.template get<I>()*s; }
+};
+
+template<typename E> struct VectorNegated : VectorExpression<VectorNegated<E>, typename E::vector_type> {
+    typedef typename E::vector_type vector_type;
+    E e;
+    constexpr explicit VectorNegated(const E& a) : e(a) {}
+    template<int I> constexpr float get() const { return -e.template get<I>(); }
+};
+
+//ExpressionOperand<T>::type is the node type used to hold T inside an expression.  It is undefined for all other types, which keeps the operators below out of overload resolution for them.
+template<typename T> struct ExpressionOperand {};
+
+template<> struct ExpressionOperand<Vector2> {
+    typedef VectorLeaf<Vector2> type;
+    static constexpr type wrap(const Vector2& v) { return type(v); }
+};
+
+template<> struct ExpressionOperand<Vector3> {
+    typedef VectorLeaf<Vector3> type;
+    static constexpr type wrap(const Vector3& v) { return type(v); }
+};
+
+template<typename L, typename R> struct ExpressionOperand< VectorSum<L,R> > {
+    typedef VectorSum<L,R> type;
+    static constexpr const type& wrap(const type& e) { return e; }
+};
+
+template<typename L, typename R> struct ExpressionOperand< VectorDifference<L,R> > {
+    typedef VectorDifference<L,R> type;
+    static constexpr const type& wrap(const type& e) { return e; }
+};
+
+template<typename E> struct ExpressionOperand< VectorScaled<E> > {
+    typedef VectorScaled<E> type;
+    static constexpr const type& wrap(const type& e) { return e; }
+};
+
+template<typename E> struct ExpressionOperand< VectorNegated<E> > {
+    typedef VectorNegated<E> type;
+    static constexpr const type& wrap(const type& e) { return e; }
+};
+
+//Both operands must be Vector2 (or Vector2 expressions), or both Vector3.  Any other type fails substitution, so the operators below are simply not considered for it.
+template<typename A, typename B> using SameVectorType = std::is_same<typename ExpressionOperand<A>::type::vector_type, typename ExpressionOperand<B>::type::vector_type>;
+
+} // namespace RaylibOps
+
+template<typename A, typename B, typename std::enable_if<RaylibOps::SameVectorType<A,B>::value,int>::type=0>
+constexpr RaylibOps::VectorSum<typename RaylibOps::ExpressionOperand<A>::type, typename RaylibOps::ExpressionOperand<B>::type> operator+(const A& a, const B& b) {
+return {RaylibOps::ExpressionOperand<A>::wrap(a), RaylibOps::ExpressionOperand<B>::wrap(b)};
+}
+
+template<typename A, typename B, typename std::enable_if<RaylibOps::SameVectorType<A,B>::value,int>::type=0>
+constexpr RaylibOps::VectorDifference<typename RaylibOps::ExpressionOperand<A>::type, typename RaylibOps::ExpressionOperand<B>::type> operator-(const A& a, const B& b) {
+return {RaylibOps::ExpressionOperand<A>::wrap(a), RaylibOps::ExpressionOperand<B>::wrap(b)};
+}
+
+template<typename A, typename RaylibOps::ExpressionOperand<A>::type::vector_type* =nullptr>
+constexpr RaylibOps::VectorScaled<typename RaylibOps::ExpressionOperand<A>::type> operator*(const A& a, float b) {
+return {RaylibOps::ExpressionOperand<A>::wrap(a), b};
+}
+
+template<typename A, typename RaylibOps::ExpressionOperand<A>::type::vector_type* =nullptr>
+constexpr RaylibOps::VectorScaled<typename RaylibOps::ExpressionOperand<A>::type> operator*(float b, const A& a) {
+return {RaylibOps::ExpressionOperand<A>::wrap(a), b};
+}
+
+template<typename A, typename RaylibOps::ExpressionOperand<A>::type::vector_type* =nullptr>
+constexpr RaylibOps::VectorNegated<typename RaylibOps::ExpressionOperand<A>::type> operator-(const A& a) {
+return RaylibOps::VectorNegated<typename RaylibOps::ExpressionOperand<A>::type>(RaylibOps::ExpressionOperand<A>::wrap(a));
+}
+
+//Dividing or comparing an unevaluated expression evaluates it first.  Plain vectors are left to the operator/ and operator== below.
+template<typename A, typename std::enable_if<!std::is_same<A,typename RaylibOps::ExpressionOperand<A>::type::vector_type>::value,int>::type=0>
+constexpr typename RaylibOps::ExpressionOperand<A>::type::vector_type operator/(const A& a, float b) {
+    typedef typename RaylibOps::ExpressionOperand<A>::type::vector_type V;
+return static_cast<V>(a)/b;
+}
+
+template<typename A, typename B, typename std::enable_if<RaylibOps::SameVectorType<A,B>::value && !(std::is_same<A,B>::value && std::is_same<A,typename RaylibOps::ExpressionOperand<A>::type::vector_type>::value),int>::type=0>
+constexpr bool operator==(const A& a, const B& b) {
+    typedef typename RaylibOps::ExpressionOperand<A>::type::vector_type V;
+return static_cast<V>(a)==static_cast<V>(b);
+}
+#endif // VECTOR_EXPRESSION_TEMPLATES
+
+
+// Color channel helpers
+//
+// Saturating arithmetic on one unsigned char channel, written without branches (masks instead of ifs) so loops over many Colors stay straight-line code.
+// Each returns exactly what widening to int or float, operating, clamping to 0..255 and casting back would give.
+namespace RaylibOps {
+
+RAYLIBOPS_CONSTEXPR unsigned char ChannelAdd(unsigned char a, unsigned char b) {
+    unsigned int sum=a+b;  //At most 510, so bit 8 is set only on overflow
+return (unsigned char)(sum | (0u-(sum>>8)));
+}
+
+RAYLIBOPS_CONSTEXPR unsigned char ChannelSubtract(unsigned char a, unsigned char b) {
+return (unsigned char)((a-b) & -(int)(a>=b));
+}
+
+#ifndef COLOR_MODULATE_NORMALIZED
+RAYLIBOPS_CONSTEXPR unsigned char ChannelMultiply(unsigned char a, unsigned char b) {
+    unsigned int product=a*b;
+return (unsigned char)(product | (0u-(unsigned int)(product>255)));
+}
+
+RAYLIBOPS_CONSTEXPR unsigned char ChannelDivide(unsigned char a, unsigned char b) {
+    unsigned int zero=(b==0);
+    unsigned int quotient=a/(b|zero);
+return (unsigned char)(quotient | (0u-(zero & (a!=0))));
+}
+#else
+//Normalized channels (see option E in RaylibOpsConfig.hpp)
+RAYLIBOPS_CONSTEXPR unsigned char ChannelMultiply(unsigned char a, unsigned char b) {
+    unsigned int x=a*b+127;
+return (unsigned char)((x+(x>>8)+1)>>8);  //Equals x/255 for every x up to 65535
+}
+
+//ChannelReciprocals.m[b] is ceil(2^24/b).  For any n below 2^16, (n*m[b])>>24 is exactly n/b.  Entry 0 holds 2^24, i.e. divides by 1.
+struct ChannelReciprocalTable {
+    unsigned long long m[256];
+    constexpr ChannelReciprocalTable() : m() {
+        m[0]=1ull<<24;
+        for (int b=1; b<256; b++) m[b]=((1ull<<24)+b-1)/b;
+    }
+};
+inline constexpr ChannelReciprocalTable ChannelReciprocals;
+
+RAYLIBOPS_CONSTEXPR unsigned char ChannelDivide(unsigned char a, unsigned char b) {
+    unsigned int quotient=(unsigned int)(((a*255u+(b>>1))*ChannelReciprocals.m[b])>>24);  //a*255/b rounded.  b==0 gives a*255, which saturates to 255 (or 0 for 0/0)
+return (unsigned char)(quotient | (0u-(unsigned int)(quotient>255)));
+}
+#endif // COLOR_MODULATE_NORMALIZED
+
+RAYLIBOPS_CONSTEXPR unsigned char ChannelClamp(float f) {
+    f=(f>0.0f)?f:0.0f;  //These compile to min/max instructions, not branches
+    f=(f<255.0f)?f:255.0f;
+return (unsigned char)f;
+}
+
+} // namespace RaylibOps
+
+//Addition overloads: componentwise addition.  The vector operators are templates on the generic core above, for Vector2, Vector3, Vector4 and the integer vectors.
+template<typename V> RAYLIBOPS_TEMPLATE_CONSTEXPR RaylibOps::PlainVector<V> operator+(const V& a, const V& b) {
+    RAYLIBOPS_COUNT_VECTOR(V,Add);
+return RaylibOps::Componentwise<RaylibOps::ComponentAdd>(a,b);
+}
+
+template<typename V> RAYLIBOPS_TEMPLATE_CONSTEXPR RaylibOps::AnyVector<V,V&> operator+=(V& a, const RaylibOps::VectorOperand<V>& b) {
+    RAYLIBOPS_COUNT_VECTOR(V,AddAssign);
+    a=a+b;
+return a;
+}
+
+// Matrix kernels behind the Matrix operators.
+//
+// raylib stores a Matrix as 16 floats in the order m0 m4 m8 m12 / m1 m5 m9 m13 / m2 m6 m10 m14 / m3 m7 m11 m15, i.e. each 4 float row of memory holds
+// m[R], m[4+R], m[8+R], m[12+R].  In terms of those memory rows raymath's MatrixMultiply(left,right) is: result row R = sum over k of right[R][k] * left row k,
+// so each result row is four broadcasts of one right row against the rows of left, kept in registers.  Two result rows at a time with AVX, one with SSE or NEON.
+// The products are summed in the same order as MatrixMultiply, so results are identical unless the compiler fuses multiply-adds in raymath's version.  out may be the same Matrix as left or right: all of left is loaded
+// before anything is stored, and right row R is no longer needed once result row R is written.
+namespace RaylibOps {
+
+RAYLIBOPS_INLINE void MultiplyMatrices(const Matrix& left, const Matrix& right, Matrix& out) {
+    const float* l=&left.m0;
+    const float* r=&right.m0;
+    float* o=&out.m0;
+#if defined(RAYLIBOPS_SIMD_AVX)
+    __m256 l0=_mm256_broadcast_ps((const __m128*)(l+0)), l1=_mm256_broadcast_ps((const __m128*)(l+4));
+    __m256 l2=_mm256_broadcast_ps((const __m128*)(l+8)), l3=_mm256_broadcast_ps((const __m128*)(l+12));
+    for (int row=0; row<16; row+=8) {
+        __m256 rows=_mm256_loadu_ps(r+row);
+        __m256 sum=_mm256_mul_ps(_mm256_permute_ps(rows,0x00),l0);
+        sum=_mm256_add_ps(sum,_mm256_mul_ps(_mm256_permute_ps(rows,0x55),l1));
+        sum=_mm256_add_ps(sum,_mm256_mul_ps(_mm256_permute_ps(rows,0xAA),l2));
+        sum=_mm256_add_ps(sum,_mm256_mul_ps(_mm256_permute_ps(rows,0xFF),l3));
+        _mm256_storeu_ps(o+row,sum);
+    }
+#elif defined(RAYLIBOPS_SIMD_SSE)
+    __m128 l0=_mm_loadu_ps(l+0), l1=_mm_loadu_ps(l+4), l2=_mm_loadu_ps(l+8), l3=_mm_loadu_ps(l+12);
+    for (int row=0; row<16; row+=4) {
+        __m128 rows=_mm_loadu_ps(r+row);
+        __m128 sum=_mm_mul_ps(_mm_shuffle_ps(rows,rows,0x00),l0);
+        sum=_mm_add_ps(sum,_mm_mul_ps(_mm_shuffle_ps(rows,rows,0x55),l1));
+        sum=_mm_add_ps(sum,_mm_mul_ps(_mm_shuffle_ps(rows,rows,0xAA),l2));
+        sum=_mm_add_ps(sum,_mm_mul_ps(_mm_shuffle_ps(rows,rows,0xFF),l3));
+        _mm_storeu_ps(o+row,sum);
+    }
+#elif defined(RAYLIBOPS_SIMD_NEON)
+    float32x4_t l0=vld1q_f32(l+0), l1=vld1q_f32(l+4), l2=vld1q_f32(l+8), l3=vld1q_f32(l+12);
+    for (int row=0; row<16; row+=4) {
+        float32x4_t rows=vld1q_f32(r+row);
+        float32x4_t sum=vmulq_n_f32(l0,vgetq_lane_f32(rows,0));
+        sum=vaddq_f32(sum,vmulq_n_f32(l1,vgetq_lane_f32(rows,1)));
+        sum=vaddq_f32(sum,vmulq_n_f32(l2,vgetq_lane_f32(rows,2)));
+        sum=vaddq_f32(sum,vmulq_n_f32(l3,vgetq_lane_f32(rows,3)));
+        vst1q_f32(o+row,sum);
+    }
+#else
+    float result[16];
+    for (int row=0; row<16; row+=4) {
+        for (int c=0; c<4; c++) result[row+c]=r[row]*l[c] + r[row+1]*l[4+c] + r[row+2]*l[8+c] + r[row+3]*l[12+c];
+    }
+    for (int i=0; i<16; i++) o[i]=result[i];
+#endif
+}
+
+RAYLIBOPS_INLINE void AddMatrices(const Matrix& left, const Matrix& right, Matrix& out) {
+    const float* l=&left.m0;
+    const float* r=&right.m0;
+    float* o=&out.m0;
+    for (int i=0; i<16; i+=Simd::FloatWidth) Simd::Store(o+i,Simd::Add(Simd::Load(l+i),Simd::Load(r+i)));
+}
+
+RAYLIBOPS_INLINE void SubtractMatrices(const Matrix& left, const Matrix& right, Matrix& out) {
+    const float* l=&left.m0;
+    const float* r=&right.m0;
+    float* o=&out.m0;
+    for (int i=0; i<16; i+=Simd::FloatWidth) Simd::Store(o+i,Simd::Subtract(Simd::Load(l+i),Simd::Load(r+i)));
+}
+
+} // namespace RaylibOps
+
+RAYLIBOPS_INLINE Matrix operator+(const Matrix& left, const Matrix& right) {
+    RAYLIBOPS_COUNT(MatrixAdd);
+    Matrix result;
+    RaylibOps::AddMatrices(left,right,result);
+return result;
+}
+
+RAYLIBOPS_INLINE Matrix& operator+=(Matrix& left, const Matrix& right) {
+    RAYLIBOPS_COUNT(MatrixAddAssign);
+    RaylibOps::AddMatrices(left,right,left);
+return left;
+}
+
+RAYLIBOPS_CONSTEXPR Color operator+(const Color& a, const Color& b) {  //Saturates at unsigned char's max of 255
+    RAYLIBOPS_COUNT(ColorAdd);
+return Color{RaylibOps::ChannelAdd(a.r,b.r), RaylibOps::ChannelAdd(a.g,b.g), RaylibOps::ChannelAdd(a.b,b.b), RaylibOps::ChannelAdd(a.a,b.a)};
+}
+
+RAYLIBOPS_CONSTEXPR Color& operator+=(Color&a, const Color& b) {
+    RAYLIBOPS_COUNT(ColorAddAssign);
+    a=a+b;
+return a;
+}
+
+//Negation: Unary Minus operator
+//Unary negation returns a new vector and leaves its operand alone, so it works on temporaries and const vectors.  To negate a vector in place use RaylibOps::Negate(v).
+//For a Quaternion, -q is the same rotation as q: see QuaternionInvert() for the inverse.
+template<typename V> RAYLIBOPS_TEMPLATE_CONSTEXPR RaylibOps::PlainVector<V> operator-(const V& a) {
+    RAYLIBOPS_COUNT_VECTOR(V,Negate);
+return RaylibOps::Componentwise<RaylibOps::ComponentNegate>(a);
+}
+
+namespace RaylibOps {
+
+template<typename V> constexpr AnyVector<V,V&> Negate(V& a) {
+    a=Componentwise<ComponentNegate>(a);
+return a;
+}
+
+} // namespace RaylibOps
+
+//Subtraction overloads: componentwise subtraction
+template<typename V> RAYLIBOPS_TEMPLATE_CONSTEXPR RaylibOps::PlainVector<V> operator-(const V& a, const V& b) {
+    RAYLIBOPS_COUNT_VECTOR(V,Subtract);
+return RaylibOps::Componentwise<RaylibOps::ComponentSubtract>(a,b);
+}
+
+template<typename V> RAYLIBOPS_TEMPLATE_CONSTEXPR RaylibOps::AnyVector<V,V&> operator-=(V& a, const RaylibOps::VectorOperand<V>& b) {
+    RAYLIBOPS_COUNT_VECTOR(V,SubtractAssign);
+    a=a-b;
+return a;
+}
+
+RAYLIBOPS_INLINE Matrix operator-(const Matrix& left, const Matrix& right) {
+    RAYLIBOPS_COUNT(MatrixSubtract);
+    Matrix result;
+    RaylibOps::SubtractMatrices(left,right,result);
+return result;
+}
+
+RAYLIBOPS_INLINE Matrix& operator-=(Matrix& left, const Matrix& right) {
+    RAYLIBOPS_COUNT(MatrixSubtractAssign);
+    RaylibOps::SubtractMatrices(left,right,left);
+return left;
+}
+
+RAYLIBOPS_CONSTEXPR Color operator-(const Color& a, const Color& b) {  //Saturates at zero
+    RAYLIBOPS_COUNT(ColorSubtract);
+return Color{RaylibOps::ChannelSubtract(a.r,b.r), RaylibOps::ChannelSubtract(a.g,b.g), RaylibOps::ChannelSubtract(a.b,b.b), RaylibOps::ChannelSubtract(a.a,b.a)};
+}
+
+RAYLIBOPS_CONSTEXPR Color& operator-=(Color&a, const Color& b) {
+    RAYLIBOPS_COUNT(ColorSubtractAssign);
+    a=a-b;
+return a;
+}
+
+//Multiplication overload only provides for multiplying a vector by a scalar, on either side.   Vector * Vector is not overloaded to avoid confusion whether one intends a dot product, cross product, etc.
+template<typename V> RAYLIBOPS_TEMPLATE_CONSTEXPR RaylibOps::PlainVector<V> operator*(const V& a, typename RaylibOps::VectorTraits<V>::Scalar b) {
+    RAYLIBOPS_COUNT_VECTOR(V,Scale);
+return RaylibOps::Componentwise<RaylibOps::ComponentMultiply>(a,b);
+}
+
+template<typename V> RAYLIBOPS_TEMPLATE_CONSTEXPR RaylibOps::PlainVector<V> operator*(typename RaylibOps::VectorTraits<V>::Scalar b, const V& a) {
+    RAYLIBOPS_COUNT_VECTOR(V,Scale);
+return RaylibOps::Componentwise<RaylibOps::ComponentMultiply>(a,b);
+}
+
+//Same product as raymath's MatrixMultiply(left,right), i.e. the transform left followed by right
+RAYLIBOPS_INLINE Matrix operator*(const Matrix& left, const Matrix& right) {
+    RAYLIBOPS_COUNT(MatrixMultiply);
+    Matrix result;
+    RaylibOps::MultiplyMatrices(left,right,result);
+return result;
+}
+
+//Multiplies in place, without copying left
+RAYLIBOPS_INLINE Matrix& operator*=(Matrix& left, const Matrix& right) {
+    RAYLIBOPS_COUNT(MatrixMultiplyAssign);
+    RaylibOps::MultiplyMatrices(left,right,left);
+return left;
+}
+
+//Transforms a point: the same as raymath's Vector3Transform(v,m), with w taken as 1 and no perspective divide
+RAYLIBOPS_CONSTEXPR Vector3 operator*(const Matrix& m, const Vector3& v) {
+    RAYLIBOPS_COUNT(MatrixTransformVector3);
+return Vector3{m.m0*v.x + m.m4*v.y + m.m8*v.z + m.m12, m.m1*v.x + m.m5*v.y + m.m9*v.z + m.m13, m.m2*v.x + m.m6*v.y + m.m10*v.z + m.m14};
+}
+
+//The same as raymath's QuaternionTransform(v,m), which is a plain 4x4 matrix times vector
+RAYLIBOPS_CONSTEXPR Vector4 operator*(const Matrix& m, const Vector4& v) {
+    RAYLIBOPS_COUNT(MatrixTransformVector4);
+return Vector4{m.m0*v.x + m.m4*v.y + m.m8*v.z + m.m12*v.w, m.m1*v.x + m.m5*v.y + m.m9*v.z + m.m13*v.w,
+               m.m2*v.x + m.m6*v.y + m.m10*v.z + m.m14*v.w, m.m3*v.x + m.m7*v.y + m.m11*v.z + m.m15*v.w};
+}
+
+template<typename V> RAYLIBOPS_TEMPLATE_CONSTEXPR RaylibOps::AnyVector<V,V&> operator*=(V& a, const typename RaylibOps::VectorTraits<V>::Scalar b) {
+    RAYLIBOPS_COUNT_VECTOR(V,ScaleAssign);
+    a=a*b;
+return a;
+}
+
+//I'm not sure if the following is useful, but here it is anyway for completeness
+RAYLIBOPS_CONSTEXPR Color operator*(const Color& a, const Color& b) {  //Product of the raw 0-255 channels, saturating at 255, or normalized with COLOR_MODULATE_NORMALIZED
+    RAYLIBOPS_COUNT(ColorMultiply);
+return Color{RaylibOps::ChannelMultiply(a.r,b.r), RaylibOps::ChannelMultiply(a.g,b.g), RaylibOps::ChannelMultiply(a.b,b.b), RaylibOps::ChannelMultiply(a.a,b.a)};
+}
+
+RAYLIBOPS_CONSTEXPR Color& operator*=(Color&a, const Color& b) {
+    RAYLIBOPS_COUNT(ColorMultiplyAssign);
+    a=a*b;
+return a;
+}
+
+RAYLIBOPS_CONSTEXPR Color operator*(const Color& a, const float b) {  //Computed in float, then clamped between 0 and 255
+    RAYLIBOPS_COUNT(ColorScale);
+return Color{RaylibOps::ChannelClamp((float)a.r*b), RaylibOps::ChannelClamp((float)a.g*b), RaylibOps::ChannelClamp((float)a.b*b), RaylibOps::ChannelClamp((float)a.a*b)};
+}
+
+RAYLIBOPS_CONSTEXPR Color& operator*=(Color&a, const float b) {
+    RAYLIBOPS_COUNT(ColorScaleAssign);
+    a=a*b;
+return a;
+}
+
+//Division overload: Merely scalar multiplication by the reciprocal, with a Divide-By-Zero check chosen by the DIVISION_BY_ZERO_ option in RaylibOpsConfig.hpp.
+//
+//Each policy's Reciprocal(b) returns the factor to multiply by.  Pass a policy object as the tag argument of RaylibOps::Divide() to choose per call.
+//The integer vectors divide each component instead, truncating, with the policy's Quotient(a,b).  Integers have no infinity, so DivisionIEEE gives zero for them like DivisionReturnsZero.
+//Both are constexpr, so e.g. constexpr Vector2 half=Vector2{1,2}/2.0f; compiles whatever the policy, and dividing by zero in a constant expression does not compile.
+#include <cassert>
+namespace RaylibOps {
+
+struct DivisionThrows {
+    static constexpr float Reciprocal(float b) {
+        if (b==0.0f) {
+            std::fputs("Division by zero error.\n",stderr);
+            throw std::domain_error("Division by zero error");
+        }
+    return 1.0f/b;
+    }
+
+    static constexpr int Quotient(int a, int b) {
+        if (b==0) {
+            std::fputs("Division by zero error.\n",stderr);
+            throw std::domain_error("Division by zero error");
+        }
+    return a/b;
+    }
+};
+
+struct DivisionAsserts {
+    static constexpr float Reciprocal(float b) {
+        assert(b!=0.0f && "Division by zero error");
+    return 1.0f/b;
+    }
+
+    static constexpr int Quotient(int a, int b) {
+        assert(b!=0 && "Division by zero error");
+    return a/b;
+    }
+};
+
+struct DivisionReturnsZero {
+    static constexpr float Reciprocal(float b) {
+        float recip=1.0f/b;
+    return (b!=0.0f)?recip:0.0f;  //A select, not a branch
+    }
+
+    static constexpr int Quotient(int a, int b) {
+        int zero=(b==0);
+    return (a/(b|zero)) & (zero-1);  //Divides by 1 instead of 0, then masks the result to 0
+    }
+};
+
+struct DivisionIEEE {
+    static constexpr float Reciprocal(float b) { return 1.0f/b; }
+    static constexpr int Quotient(int a, int b) { return DivisionReturnsZero::Quotient(a,b); }
+};
+
+#if defined(DIVISION_BY_ZERO_ASSERT)
+typedef DivisionAsserts DefaultDivision;
+#elif defined(DIVISION_BY_ZERO_IEEE)
+typedef DivisionIEEE DefaultDivision;
+#elif defined(DIVISION_BY_ZERO_RETURN_ZERO)
+typedef DivisionReturnsZero DefaultDivision;
+#else
+typedef DivisionThrows DefaultDivision;
+#endif
+
+template<typename Policy> struct ComponentQuotient {
+    template<typename T> static constexpr T Apply(T a, T b) { return Policy::Quotient(a,b); }
+};
+
+template<typename V, typename Policy> constexpr FloatVector<V> Divide(const V& a, const typename VectorTraits<V>::Scalar b, Policy) {
+return Componentwise<ComponentMultiply>(a,Policy::Reciprocal(b));
+}
+
+template<typename V, typename Policy> constexpr IntegerVector<V> Divide(const V& a, const typename VectorTraits<V>::Scalar b, Policy) {
+return Componentwise< ComponentQuotient<Policy> >(a,b);
+}
+
+} // namespace RaylibOps
+
+template<typename V> RAYLIBOPS_TEMPLATE_CONSTEXPR RaylibOps::AnyVector<V> operator/(const V& a, const typename RaylibOps::VectorTraits<V>::Scalar b) {
+    RAYLIBOPS_COUNT_VECTOR(V,Divide);
+return RaylibOps::Divide(a,b,RaylibOps::DefaultDivision());
+}
+
+template<typename V> RAYLIBOPS_TEMPLATE_CONSTEXPR RaylibOps::AnyVector<V,V&> operator/=(V& a, const typename RaylibOps::VectorTraits<V>::Scalar b) {
+    RAYLIBOPS_COUNT_VECTOR(V,DivideAssign);
+    a=a/b;
+return a;
+}
+
+//I'm not sure if the following is useful either, but here it is for completeness
+RAYLIBOPS_CONSTEXPR Color operator/(const Color& a, const Color& b) {  //Quotient rounded down, or normalized with COLOR_MODULATE_NORMALIZED.  A channel divided by zero gives 255 (or 0 for 0/0)
+    RAYLIBOPS_COUNT(ColorDivide);
+return Color{RaylibOps::ChannelDivide(a.r,b.r), RaylibOps::ChannelDivide(a.g,b.g), RaylibOps::ChannelDivide(a.b,b.b), RaylibOps::ChannelDivide(a.a,b.a)};
+}
+
+RAYLIBOPS_CONSTEXPR Color& operator/=(Color&a, const Color& b) {
+    RAYLIBOPS_COUNT(ColorDivideAssign);
+    a=a/b;
+return a;
+}
+
+RAYLIBOPS_CONSTEXPR Color operator/(const Color& a, const float b) {  //Computed in float, then clamped between 0 and 255
+    RAYLIBOPS_COUNT(ColorDivideScalar);
+return Color{RaylibOps::ChannelClamp((float)a.r/b), RaylibOps::ChannelClamp((float)a.g/b), RaylibOps::ChannelClamp((float)a.b/b), RaylibOps::ChannelClamp((float)a.a/b)};
+}
+
+RAYLIBOPS_CONSTEXPR Color& operator/=(Color&a, const float b) {
+    RAYLIBOPS_COUNT(ColorDivideScalarAssign);
+    a=a/b;
+return a;
+}
+
+
+//Rectangle and BoundingBox overloads
+//
+//  r+v, r-v      translation by a Vector2 (Vector3 for a BoundingBox)
+//  r*s, r*v      scaling about the origin, by a float or per axis.  A BoundingBox's corners are reordered if a factor is negative.
+//  a|b           the smallest rectangle or box containing both.  box|point grows a box to include a point.
+//  a&b           the overlap of the two.  For Rectangles it is {0,0,0,0} when CheckCollisionRecs(a,b) is false, as with GetCollisionRec(a,b).
+//                For BoundingBoxes, touching counts as overlapping as in CheckCollisionBoxes(); otherwise min>max on some axis, which RaylibOps::IsEmpty() detects.
+namespace RaylibOps {
+
+RAYLIBOPS_CONSTEXPR float Lesser(float a, float b) { return (b<a)?b:a; }
+RAYLIBOPS_CONSTEXPR float Greater(float a, float b) { return (a<b)?b:a; }
+
+RAYLIBOPS_CONSTEXPR Vector3 Lesser(const Vector3& a, const Vector3& b) { return Vector3{Lesser(a.x,b.x), Lesser(a.y,b.y), Lesser(a.z,b.z)}; }
+RAYLIBOPS_CONSTEXPR Vector3 Greater(const Vector3& a, const Vector3& b) { return Vector3{Greater(a.x,b.x), Greater(a.y,b.y), Greater(a.z,b.z)}; }
+
+RAYLIBOPS_CONSTEXPR bool IsEmpty(const Rectangle& r) { return !(r.width>0.0f && r.height>0.0f); }
+RAYLIBOPS_CONSTEXPR bool IsEmpty(const BoundingBox& b) { return !(b.min.x<=b.max.x && b.min.y<=b.max.y && b.min.z<=b.max.z); }
+
+//The same test as CheckCollisionBoxes(a,b)
+RAYLIBOPS_CONSTEXPR bool Overlaps(const BoundingBox& a, const BoundingBox& b) {
+return a.max.x>=b.min.x && a.min.x<=b.max.x && a.max.y>=b.min.y && a.min.y<=b.max.y && a.max.z>=b.min.z && a.min.z<=b.max.z;
+}
+
+} // namespace RaylibOps
+
+RAYLIBOPS_CONSTEXPR Rectangle operator+(const Rectangle& r, const Vector2& v) {
+return Rectangle{r.x+v.x, r.y+v.y, r.width, r.height};
+}
+
+RAYLIBOPS_CONSTEXPR Rectangle operator-(const Rectangle& r, const Vector2& v) {
+return Rectangle{r.x-v.x, r.y-v.y, r.width, r.height};
+}
+
+RAYLIBOPS_CONSTEXPR Rectangle& operator+=(Rectangle& r, const Vector2& v) {
+    r=r+v;
+return r;
+}
+
+RAYLIBOPS_CONSTEXPR Rectangle& operator-=(Rectangle& r, const Vector2& v) {
+    r=r-v;
+return r;
+}
+
+RAYLIBOPS_CONSTEXPR Rectangle operator*(const Rectangle& r, const float s) {
+return Rectangle{r.x*s, r.y*s, r.width*s, r.height*s};
+}
+
+RAYLIBOPS_CONSTEXPR Rectangle operator*(const Rectangle& r, const Vector2& s) {
+return Rectangle{r.x*s.x, r.y*s.y, r.width*s.x, r.height*s.y};
+}
+
+RAYLIBOPS_CONSTEXPR Rectangle& operator*=(Rectangle& r, const float s) {
+    r=r*s;
+return r;
+}
+
+RAYLIBOPS_CONSTEXPR Rectangle& operator*=(Rectangle& r, const Vector2& s) {
+    r=r*s;
+return r;
+}
+
+RAYLIBOPS_CONSTEXPR Rectangle operator|(const Rectangle& a, const Rectangle& b) {
+    float x=RaylibOps::Lesser(a.x,b.x), y=RaylibOps::Lesser(a.y,b.y);
+return Rectangle{x, y, RaylibOps::Greater(a.x+a.width,b.x+b.width)-x, RaylibOps::Greater(a.y+a.height,b.y+b.height)-y};
+}
+
+RAYLIBOPS_CONSTEXPR Rectangle operator&(const Rectangle& a, const Rectangle& b) {
+    if (!(a.x<b.x+b.width && a.x+a.width>b.x && a.y<b.y+b.height && a.y+a.height>b.y)) return Rectangle{0.0f, 0.0f, 0.0f, 0.0f};
+    float x=RaylibOps::Greater(a.x,b.x), y=RaylibOps::Greater(a.y,b.y);
+return Rectangle{x, y, RaylibOps::Lesser(a.x+a.width,b.x+b.width)-x, RaylibOps::Lesser(a.y+a.height,b.y+b.height)-y};
+}
+
+RAYLIBOPS_CONSTEXPR Rectangle& operator|=(Rectangle& a, const Rectangle& b) {
+    a=a|b;
+return a;
+}
+
+RAYLIBOPS_CONSTEXPR Rectangle& operator&=(Rectangle& a, const Rectangle& b) {
+    a=a&b;
+return a;
+}
+
+RAYLIBOPS_CONSTEXPR BoundingBox operator+(const BoundingBox& b, const Vector3& v) {
+return BoundingBox{Vector3{b.min.x+v.x, b.min.y+v.y, b.min.z+v.z}, Vector3{b.max.x+v.x, b.max.y+v.y, b.max.z+v.z}};
+}
+
+RAYLIBOPS_CONSTEXPR BoundingBox operator-(const BoundingBox& b, const Vector3& v) {
+return BoundingBox{Vector3{b.min.x-v.x, b.min.y-v.y, b.min.z-v.z}, Vector3{b.max.x-v.x, b.max.y-v.y, b.max.z-v.z}};
+}
+
+RAYLIBOPS_CONSTEXPR BoundingBox& operator+=(BoundingBox& b, const Vector3& v) {
+    b=b+v;
+return b;
+}
+
+RAYLIBOPS_CONSTEXPR BoundingBox& operator-=(BoundingBox& b, const Vector3& v) {
+    b=b-v;
+return b;
+}
+
+RAYLIBOPS_CONSTEXPR BoundingBox operator*(const BoundingBox& b, const Vector3& s) {
+    Vector3 p{b.min.x*s.x, b.min.y*s.y, b.min.z*s.z}, q{b.max.x*s.x, b.max.y*s.y, b.max.z*s.z};
+return BoundingBox{RaylibOps::Lesser(p,q), RaylibOps::Greater(p,q)};
+}
+
+RAYLIBOPS_CONSTEXPR BoundingBox operator*(const BoundingBox& b, const float s) {
+return b*Vector3{s, s, s};
+}
+
+RAYLIBOPS_CONSTEXPR BoundingBox& operator*=(BoundingBox& b, const float s) {
+    b=b*s;
+return b;
+}
+
+RAYLIBOPS_CONSTEXPR BoundingBox& operator*=(BoundingBox& b, const Vector3& s) {
+    b=b*s;
+return b;
+}
+
+RAYLIBOPS_CONSTEXPR BoundingBox operator|(const BoundingBox& a, const BoundingBox& b) {
+return BoundingBox{RaylibOps::Lesser(a.min,b.min), RaylibOps::Greater(a.max,b.max)};
+}
+
+RAYLIBOPS_CONSTEXPR BoundingBox operator|(const BoundingBox& a, const Vector3& p) {
+return BoundingBox{RaylibOps::Lesser(a.min,p), RaylibOps::Greater(a.max,p)};
+}
+
+RAYLIBOPS_CONSTEXPR BoundingBox operator&(const BoundingBox& a, const BoundingBox& b) {
+return BoundingBox{RaylibOps::Greater(a.min,b.min), RaylibOps::Lesser(a.max,b.max)};
+}
+
+RAYLIBOPS_CONSTEXPR BoundingBox& operator|=(BoundingBox& a, const BoundingBox& b) {
+    a=a|b;
+return a;
+}
+
+RAYLIBOPS_CONSTEXPR BoundingBox& operator|=(BoundingBox& a, const Vector3& p) {
+    a=a|p;
+return a;
+}
+
+RAYLIBOPS_CONSTEXPR BoundingBox& operator&=(BoundingBox& a, const BoundingBox& b) {
+    a=a&b;
+return a;
+}
+
+//The point at parameter t along a ray, position+direction*t.  This is t units from the ray's start when its direction is normalized.
+RAYLIBOPS_CONSTEXPR Vector3 operator*(const Ray& r, const float t) {
+return Vector3{r.position.x+r.direction.x*t, r.position.y+r.direction.y*t, r.position.z+r.direction.z*t};
+}
+
+RAYLIBOPS_CONSTEXPR Vector3 operator*(const float t, const Ray& r) {
+return r*t;
+}
+//The integer vectors live in RaylibOps, so argument-dependent lookup searches only there.  These bring the vector operator templates in, so that a+b on two Vector2i
+//works in any namespace.  (Along with them come the other global overloads declared so far, none of which take these types.)  RaylibOpsEquality.hpp adds operator==.
+namespace RaylibOps {
+using ::operator+;
+using ::operator+=;
+using ::operator-;
+using ::operator-=;
+using ::operator*;
+using ::operator*=;
+using ::operator/;
+using ::operator/=;
+}
+
+#endif // RAYLIBOPS_ARITHMETIC_HPP_INCLUDED
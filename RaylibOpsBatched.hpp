@@ -0,0 +1,2353 @@
+#ifndef RAYLIBOPS_BATCHED_HPP_INCLUDED
+#define RAYLIBOPS_BATCHED_HPP_INCLUDED
+#include "RaylibOpsEquality.hpp"
+#include "RaylibOpsPixelFormat.hpp"
+
+// **************************************************************
+//
+//      C++ Operator Overloads for RayLib: batched operations
+//
+// **************************************************************
+//
+// Structure-of-arrays containers, the thread pool and the kernels which apply the operators to many values at once, and the Image operators.
+// Needs neither iostream nor raygui.
+
+// ********************************************
+//
+//           FRAME ARENA
+//
+// ********************************************
+//
+// RaylibOps::FrameArena hands out scratch memory from one block reserved up front, by bumping an offset, and takes all of it back at once with Reset().
+// While a FrameArena::Scope is active on a thread, the VectorArrays created on that thread (and so Vector3Array temporaries of long operator chains, BoxArrays and RayPackets)
+// draw their storage from the arena instead of the heap:
+//     RaylibOps::FrameArena scratch(64<<20);  //once
+//     { RaylibOps::FrameArena::Scope use(scratch); positions+=velocities*dt+gravity*(dt*dt*0.5f); ... }  //each frame
+//     scratch.Reset();  //at the end of the frame
+// scratch.Allocate<T>(n) returns raw space for n Ts, e.g. a temporary Image's pixels.  Allocation is a lock-free compare-and-swap, so worker threads sharing one arena never
+// wait on each other or on the heap's lock.  Freeing does nothing: memory returns only at Reset(), so every array and pointer from the arena must be gone by then.
+// Reset() itself must not run while other threads allocate.  When a request does not fit, Allocate() returns nullptr and arrays fall back to the heap as usual;
+// Overflow() reports how many bytes missed since the last Reset(), and Peak() the most ever used, to size the arena.
+#include <atomic>
+#include <new>
+#include <cstddef>
+#include <cstdint>
+
+namespace RaylibOps {
+
+class FrameArena {
+public:
+    explicit FrameArena(std::size_t capacity) : base(static_cast<unsigned char*>(::operator new(capacity, std::align_val_t(64)))), capacity(capacity), offset(0), overflow(0), peak(0) {}
+    ~FrameArena() { ::operator delete(base, std::align_val_t(64)); }
+    FrameArena(const FrameArena&)=delete;
+    FrameArena& operator=(const FrameArena&)=delete;
+
+    //bytes aligned to alignment (a power of two), or nullptr if they do not fit in what is left
+    void* Allocate(std::size_t bytes, std::size_t alignment=64) {
+        std::size_t cur=offset.load(std::memory_order_relaxed), start, end;
+        do {
+            start=(std::size_t)((((std::uintptr_t)base+cur+alignment-1) & ~(std::uintptr_t)(alignment-1))-(std::uintptr_t)base);
+            end=start+bytes;
+            if (end>capacity || end<start) {
+                overflow.fetch_add(bytes,std::memory_order_relaxed);
+            return nullptr;
+            }
+        } while (!offset.compare_exchange_weak(cur,end,std::memory_order_relaxed));
+    return base+start;
+    }
+
+    template<typename T> T* Allocate(std::size_t n) {
+        if (n>capacity/sizeof(T)) {
+            overflow.fetch_add(n*sizeof(T),std::memory_order_relaxed);
+        return nullptr;
+        }
+    return static_cast<T*>(Allocate(n*sizeof(T),alignof(T)>64?alignof(T):64));
+    }
+
+    bool Owns(const void* p) const { return p>=base && p<base+capacity; }
+
+    //Releases everything allocated so far
+    void Reset() {
+        std::size_t used=offset.load(std::memory_order_relaxed);
+        if (used>peak) peak=used;
+        offset.store(0,std::memory_order_relaxed);
+        overflow.store(0,std::memory_order_relaxed);
+    }
+
+    std::size_t Capacity() const { return capacity; }
+    std::size_t Used() const { return offset.load(std::memory_order_relaxed); }
+    std::size_t Overflow() const { return overflow.load(std::memory_order_relaxed); }
+    std::size_t Peak() const { std::size_t used=Used(); return (used>peak)?used:peak; }
+
+    //The arena VectorArrays created on this thread draw from, or nullptr for the heap
+    static FrameArena*& Current() {
+        static thread_local FrameArena* current=nullptr;
+    return current;
+    }
+
+    //Makes arena the current one on this thread until the Scope ends.  Scopes nest.
+    class Scope {
+    public:
+        explicit Scope(FrameArena& arena) : previous(Current()) { Current()=&arena; }
+        ~Scope() { Current()=previous; }
+        Scope(const Scope&)=delete;
+        Scope& operator=(const Scope&)=delete;
+    private:
+        FrameArena* previous;
+    };
+
+private:
+    unsigned char* base;
+    std::size_t capacity;
+    std::atomic<std::size_t> offset;
+    std::atomic<std::size_t> overflow;
+    std::size_t peak;
+};
+
+} // namespace RaylibOps
+
+// ********************************************
+//
+//           BATCHED VECTOR ARRAYS
+//
+// ********************************************
+//
+// Vector2Array and Vector3Array store many vectors as a structure of arrays: all the x components together, then all the y's, etc.
+// The same +, -, scalar * and scalar / operators as above then work on whole arrays at once, using the SIMD kernels selected at compile time.
+// For example, with Vector3Array positions, velocities; one can write positions+=velocities*dt; to update every particle.
+// Element i reads back as an ordinary Vector3 with positions[i] and is written with positions.Set(i,v).  Use the std::vector constructor and ToStdVector() to convert in and out.
+#include <vector>
+#include <new>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+namespace RaylibOps {
+
+//Minimal allocator handing out cache-line aligned storage for the lanes, from the thread's current FrameArena when there is one and it has room
+template<typename T, std::size_t Alignment=64> struct AlignedAllocator {
+    typedef T value_type;
+    template<typename U> struct rebind { typedef AlignedAllocator<U,Alignment> other; };
+    AlignedAllocator() : arena(FrameArena::Current()) {}
+    template<typename U> AlignedAllocator(const AlignedAllocator<U,Alignment>& other) : arena(other.arena) {}
+    T* allocate(std::size_t n) {
+        if (arena) {
+            if (void* p=arena->Allocate(n*sizeof(T),Alignment)) return static_cast<T*>(p);
+        }
+    return static_cast<T*>(::operator new(n*sizeof(T), std::align_val_t(Alignment)));
+    }
+    void deallocate(T* p, std::size_t) {
+        if (arena && arena->Owns(p)) return;
+        ::operator delete(p, std::align_val_t(Alignment));
+    }
+    //Copies draw from the arena current where they are made, not from the original's, and assignment copies the elements into the storage already held.
+    //Swap exchanges the allocators along with the buffers, so each buffer stays with the arena it came from.
+    typedef std::true_type propagate_on_container_swap;
+    AlignedAllocator select_on_container_copy_construction() const { return AlignedAllocator(); }
+    bool operator==(const AlignedAllocator& other) const { return arena==other.arena; }
+    bool operator!=(const AlignedAllocator& other) const { return arena!=other.arena; }
+
+    FrameArena* arena;
+};
+
+//Kernels on single lanes.  out may be the same pointer as a or b.
+RAYLIBOPS_INLINE void LanesAdd(const float* a, const float* b, float* out, std::size_t n) {
+    std::size_t i=0;
+    for (; i+Simd::FloatWidth<=n; i+=Simd::FloatWidth) Simd::Store(out+i, Simd::Add(Simd::Load(a+i),Simd::Load(b+i)));
+    for (; i<n; i++) out[i]=a[i]+b[i];
+}
+
+RAYLIBOPS_INLINE void LanesSubtract(const float* a, const float* b, float* out, std::size_t n) {
+    std::size_t i=0;
+    for (; i+Simd::FloatWidth<=n; i+=Simd::FloatWidth) Simd::Store(out+i, Simd::Subtract(Simd::Load(a+i),Simd::Load(b+i)));
+    for (; i<n; i++) out[i]=a[i]-b[i];
+}
+
+RAYLIBOPS_INLINE void LanesScale(const float* a, float s, float* out, std::size_t n) {
+    std::size_t i=0;
+    Simd::Floats sv=Simd::Splat(s);
+    for (; i+Simd::FloatWidth<=n; i+=Simd::FloatWidth) Simd::Store(out+i, Simd::Multiply(Simd::Load(a+i),sv));
+    for (; i<n; i++) out[i]=a[i]*s;
+}
+
+//Number of components and component access for each vector type which can be stored in a VectorArray
+template<typename V> struct VectorLayout;
+
+template<> struct VectorLayout<Vector2> {
+    static const int Dimension=2;
+    static float Get(const Vector2& v, int c) { return (c==0)?v.x:v.y; }
+    static void Set(Vector2& v, int c, float f) { if (c==0) v.x=f; else v.y=f; }
+};
+
+template<> struct VectorLayout<Vector3> {
+    static const int Dimension=3;
+    static float Get(const Vector3& v, int c) { return (c==0)?v.x:(c==1)?v.y:v.z; }
+    static void Set(Vector3& v, int c, float f) { if (c==0) v.x=f; else if (c==1) v.y=f; else v.z=f; }
+};
+
+template<typename V> class VectorArray {
+public:
+    typedef V vector_type;
+    static const int Dimension=VectorLayout<V>::Dimension;
+
+    VectorArray() : count(0) {}
+
+    explicit VectorArray(std::size_t n, const V& fill=V{}) : count(n) {
+        for (int c=0; c<Dimension; c++) lanes[c].assign(n, VectorLayout<V>::Get(fill,c));
+    }
+
+    VectorArray(const std::vector<V>& v) : count(v.size()) {
+        for (int c=0; c<Dimension; c++) {
+            lanes[c].resize(count);
+            for (std::size_t i=0; i<count; i++) lanes[c][i]=VectorLayout<V>::Get(v[i],c);
+        }
+    }
+
+    std::vector<V> ToStdVector() const {
+        std::vector<V> v(count);
+        for (int c=0; c<Dimension; c++) {
+            for (std::size_t i=0; i<count; i++) VectorLayout<V>::Set(v[i],c,lanes[c][i]);
+        }
+    return v;
+    }
+
+    std::size_t size() const { return count; }
+
+    void resize(std::size_t n) {
+        for (int c=0; c<Dimension; c++) lanes[c].resize(n);
+        count=n;
+    }
+
+    V operator[](std::size_t i) const {
+        V v;
+        for (int c=0; c<Dimension; c++) VectorLayout<V>::Set(v,c,lanes[c][i]);
+    return v;
+    }
+
+    void Set(std::size_t i, const V& v) {
+        for (int c=0; c<Dimension; c++) lanes[c][i]=VectorLayout<V>::Get(v,c);
+    }
+
+    //Direct access to one component lane: Lane(0) holds every x, Lane(1) every y, etc.
+    float* Lane(int c) { return lanes[c].data(); }
+    const float* Lane(int c) const { return lanes[c].data(); }
+
+private:
+    std::size_t count;
+    std::vector<float, AlignedAllocator<float> > lanes[Dimension];
+};
+
+typedef VectorArray<Vector2> Vector2Array;
+typedef VectorArray<Vector3> Vector3Array;
+
+template<typename V> void CheckSameSize(const VectorArray<V>& a, const VectorArray<V>& b) {
+    if (a.size()!=b.size()) {
+        std::fputs("Vector array size mismatch.\n",stderr);
+        throw std::length_error("Vector array size mismatch");
+    }
+}
+
+//One bit per element, e.g. the result of comparing two arrays element by element
+class BitMask {
+public:
+    explicit BitMask(std::size_t n=0) : words((n+63)/64,0), count(n) {}
+
+    bool operator[](std::size_t i) const { return (words[i>>6]>>(i&63)) & 1u; }
+    void Set(std::size_t i, bool value=true) { words[i>>6]|=std::uint64_t(value)<<(i&63); }
+    std::size_t size() const { return count; }
+
+    //Sets FloatWidth consecutive bits from the low bits of lanes.  i must be a multiple of FloatWidth, so the bits never straddle two words.
+    void SetLanes(std::size_t i, unsigned int lanes) { words[i>>6]|=std::uint64_t(lanes)<<(i&63); }
+
+    //Number of bits set
+    std::size_t Count() const {
+        std::size_t total=0;
+        for (std::size_t w=0; w<words.size(); w++) {
+            std::uint64_t v=words[w];
+            for (; v; v&=v-1) total++;
+        }
+    return total;
+    }
+
+    const std::vector<std::uint64_t>& Words() const { return words; }
+
+private:
+    std::vector<std::uint64_t> words;
+    std::size_t count;
+};
+
+//Bulk ApproximatelyEqual(): bit i of the result is set if a[i] equals b[i] under Tolerance.  Each lane is compared with SIMD, FloatWidth elements at a time.
+template<typename Tolerance=DefaultTolerance, typename V> BitMask EqualityMask(const VectorArray<V>& a, const VectorArray<V>& b) {
+    CheckSameSize(a,b);
+    std::size_t n=a.size(), i=0;
+    BitMask mask(n);
+    const unsigned int all=(1u<<Simd::FloatWidth)-1;
+    for (; i+Simd::FloatWidth<=n; i+=Simd::FloatWidth) {
+        unsigned int lanes=all;
+        for (int c=0; c<VectorArray<V>::Dimension; c++) lanes&=Tolerance::EqualBits(Simd::Load(a.Lane(c)+i),Simd::Load(b.Lane(c)+i));
+        mask.SetLanes(i,lanes);
+    }
+    for (; i<n; i++) mask.Set(i,ApproximatelyEqual<Tolerance>(a[i],b[i]));
+return mask;
+}
+
+//The same for ordinary arrays of Vector2, Vector3 or Vector4.  Branch-free per element, but not explicitly SIMD: store vectors in a VectorArray for the fastest comparisons.
+template<typename Tolerance=DefaultTolerance, typename V> BitMask EqualityMask(const V* a, const V* b, std::size_t n) {
+    BitMask mask(n);
+    for (std::size_t i=0; i<n; i++) mask.Set(i,ApproximatelyEqual<Tolerance>(a[i],b[i]));
+return mask;
+}
+
+template<typename V> VectorArray<V> operator+(const VectorArray<V>& a, const VectorArray<V>& b) {
+    CheckSameSize(a,b);
+    VectorArray<V> r(a.size());
+    for (int c=0; c<VectorArray<V>::Dimension; c++) LanesAdd(a.Lane(c),b.Lane(c),r.Lane(c),a.size());
+return r;
+}
+
+template<typename V> VectorArray<V>& operator+=(VectorArray<V>& a, const VectorArray<V>& b) {
+    CheckSameSize(a,b);
+    for (int c=0; c<VectorArray<V>::Dimension; c++) LanesAdd(a.Lane(c),b.Lane(c),a.Lane(c),a.size());
+return a;
+}
+
+template<typename V> VectorArray<V> operator-(const VectorArray<V>& a, const VectorArray<V>& b) {
+    CheckSameSize(a,b);
+    VectorArray<V> r(a.size());
+    for (int c=0; c<VectorArray<V>::Dimension; c++) LanesSubtract(a.Lane(c),b.Lane(c),r.Lane(c),a.size());
+return r;
+}
+
+template<typename V> VectorArray<V>& operator-=(VectorArray<V>& a, const VectorArray<V>& b) {
+    CheckSameSize(a,b);
+    for (int c=0; c<VectorArray<V>::Dimension; c++) LanesSubtract(a.Lane(c),b.Lane(c),a.Lane(c),a.size());
+return a;
+}
+
+template<typename V> VectorArray<V> operator*(const VectorArray<V>& a, float b) {
+    VectorArray<V> r(a.size());
+    for (int c=0; c<VectorArray<V>::Dimension; c++) LanesScale(a.Lane(c),b,r.Lane(c),a.size());
+return r;
+}
+
+template<typename V> VectorArray<V>& operator*=(VectorArray<V>& a, float b) {
+    for (int c=0; c<VectorArray<V>::Dimension; c++) LanesScale(a.Lane(c),b,a.Lane(c),a.size());
+return a;
+}
+
+//Division: scalar multiplication by the reciprocal, with the same Divide-By-Zero policy as for a single vector
+template<typename V> VectorArray<V> operator/(const VectorArray<V>& a, float b) {
+return a*DefaultDivision::Reciprocal(b);
+}
+
+template<typename V> VectorArray<V>& operator/=(VectorArray<V>& a, float b) {
+return a*=DefaultDivision::Reciprocal(b);
+}
+
+} // namespace RaylibOps
+
+
+// ********************************************
+//
+//           PARALLEL EXECUTION
+//
+// ********************************************
+// RaylibOps::for_each_parallel(values,n,f) calls f(values[i]) for every element, and RaylibOps::transform(in,n,out,f) sets out[i]=f(in[i]), or f(a[i],b[i])
+// with two inputs, spreading the elements over a pool of threads.  f is usually a lambda built from the operators, for example
+//     RaylibOps::for_each_parallel(particles.data(),particles.size(),[dt](Particle& p) { p.position+=p.velocity*dt; });
+// f is called concurrently, so each element must be independent of the others.  std::vector overloads are provided as well.
+//
+// ThreadPool::Default() starts one worker per hardware thread, less one for the calling thread, which works too, the first time it is used.
+// The range is cut into chunks which are whole cache lines of elements, at least 16 KB each and about eight per thread.  Threads take chunks one at a time
+// from a shared counter, so a thread which finishes early keeps taking chunks until none are left instead of idling while another works through a fixed share.
+// A call made from inside f, or from a worker, runs serially on that thread.  If f throws, the chunks nobody has started are skipped and the first exception
+// is rethrown in the caller.
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <exception>
+#include <numeric>
+#include <system_error>
+#include <algorithm>
+
+namespace RaylibOps {
+
+class ThreadPool {
+public:
+    //threads counts the calling thread, so threads-1 workers are started; 0 means one thread per hardware thread
+    explicit ThreadPool(unsigned int threads=0) : current(nullptr), open(false), stopping(false), generation(0), helpersWanted(0), helpersJoined(0), working(0) {
+        if (threads==0) threads=std::max(1u,std::thread::hardware_concurrency());
+        for (unsigned int i=1; i<threads; i++) {
+            try {
+                workers.emplace_back(&ThreadPool::WorkerLoop,this);
+            }
+            catch (const std::system_error&) {  //Carry on with the threads which could be started
+                break;
+            }
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping=true;
+        }
+        wake.notify_all();
+        for (std::thread& t : workers) t.join();
+    }
+
+    ThreadPool(const ThreadPool&)=delete;
+    ThreadPool& operator=(const ThreadPool&)=delete;
+
+    //Threads which work on a Run(), including the caller
+    unsigned int size() const { return (unsigned int)workers.size()+1; }
+
+    //Calls work(begin,end) for chunks of [0,n) on up to maxThreads threads including the calling one (0 for all), and returns when all are done
+    template<typename Work> void Run(std::size_t n, std::size_t chunk, Work&& work, unsigned int maxThreads=0) {
+        if (chunk==0) chunk=1;
+        if (workers.empty() || n<=chunk || maxThreads==1 || InsidePool()) {
+            work((std::size_t)0,n);
+        return;
+        }
+        std::lock_guard<std::mutex> oneJobAtATime(running);
+        Job job(n,chunk,&work);
+        job.run=[](void* w, std::size_t begin, std::size_t end) { (*static_cast<typename std::remove_reference<Work>::type*>(w))(begin,end); };
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            current=&job;
+            helpersWanted=(maxThreads==0)?workers.size():std::min<std::size_t>(maxThreads-1,workers.size());
+            helpersJoined=0;
+            open=true;
+            generation++;
+        }
+        wake.notify_all();
+        InsidePool()=true;
+        Claim(job);
+        InsidePool()=false;
+        {
+            //Close the job so no late worker joins it, then wait for those which did
+            std::unique_lock<std::mutex> lock(mutex);
+            open=false;
+            done.wait(lock,[this] { return working==0; });
+            current=nullptr;
+        }
+        if (job.error) std::rethrow_exception(job.error);
+    }
+
+    static ThreadPool& Default() {
+        static ThreadPool pool;
+    return pool;
+    }
+
+private:
+    struct Job {
+        Job(std::size_t count, std::size_t size, void* w) : run(nullptr), work(w), n(count), chunk(size), next(0) {}
+        void (*run)(void*, std::size_t, std::size_t);
+        void* work;
+        std::size_t n;
+        std::size_t chunk;
+        std::atomic<std::size_t> next;
+        std::mutex errorMutex;
+        std::exception_ptr error;
+    };
+
+    static bool& InsidePool() {
+        thread_local bool inside=false;
+    return inside;
+    }
+
+    static void Claim(Job& job) {
+        for (;;) {
+            std::size_t begin=job.next.fetch_add(job.chunk);
+            if (begin>=job.n) return;
+            try {
+                job.run(job.work,begin,std::min(job.n,begin+job.chunk));
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(job.errorMutex);
+                if (!job.error) job.error=std::current_exception();
+                job.next=job.n;
+            }
+        }
+    }
+
+    void WorkerLoop() {
+        InsidePool()=true;
+        std::size_t seen=0;
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            wake.wait(lock,[&] { return stopping || (open && generation!=seen && helpersJoined<helpersWanted); });
+            if (stopping) return;
+            seen=generation;
+            helpersJoined++;
+            working++;
+            Job* job=current;
+            lock.unlock();
+            Claim(*job);
+            lock.lock();
+            if (--working==0) done.notify_one();
+        }
+    }
+
+    std::vector<std::thread> workers;
+    std::mutex running;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    Job* current;
+    bool open;
+    bool stopping;
+    std::size_t generation;
+    std::size_t helpersWanted;
+    std::size_t helpersJoined;
+    std::size_t working;
+};
+
+//Elements per chunk: a whole number of 64 byte cache lines, at least 16 KB, and about eight chunks per thread
+template<typename T> std::size_t ChunkSize(std::size_t n, unsigned int threads) {
+    std::size_t perLines=64/std::gcd((std::size_t)64,sizeof(T));  //The fewest elements which fill whole cache lines
+    std::size_t chunk=std::max<std::size_t>(16384/sizeof(T),n/(8*(std::size_t)threads));
+return (chunk+perLines-1)/perLines*perLines;
+}
+
+template<typename T, typename F> void for_each_parallel(T* values, std::size_t n, F f) {
+    ThreadPool& pool=ThreadPool::Default();
+    pool.Run(n,ChunkSize<T>(n,pool.size()),[values,&f](std::size_t begin, std::size_t end) { for (std::size_t i=begin; i<end; i++) f(values[i]); });
+}
+
+template<typename T, typename A, typename F> void for_each_parallel(std::vector<T,A>& values, F f) {
+    for_each_parallel(values.data(),values.size(),f);
+}
+
+template<typename In, typename Out, typename F> void transform(const In* in, std::size_t n, Out* out, F f) {
+    ThreadPool& pool=ThreadPool::Default();
+    pool.Run(n,ChunkSize<Out>(n,pool.size()),[in,out,&f](std::size_t begin, std::size_t end) { for (std::size_t i=begin; i<end; i++) out[i]=f(in[i]); });
+}
+
+template<typename A, typename B, typename Out, typename F> void transform(const A* a, const B* b, std::size_t n, Out* out, F f) {
+    ThreadPool& pool=ThreadPool::Default();
+    pool.Run(n,ChunkSize<Out>(n,pool.size()),[a,b,out,&f](std::size_t begin, std::size_t end) { for (std::size_t i=begin; i<end; i++) out[i]=f(a[i],b[i]); });
+}
+
+//out is resized to in.size()
+template<typename In, typename AI, typename Out, typename AO, typename F> void transform(const std::vector<In,AI>& in, std::vector<Out,AO>& out, F f) {
+    out.resize(in.size());
+    transform(in.data(),in.size(),out.data(),f);
+}
+
+const std::size_t ParallelMinimum=16384;
+
+//Used by the batch functions below: work(begin,end) over [0,n) on up to threads threads (0 for all the pool has), in pieces of at least ParallelMinimum.
+//Every piece starts on a multiple of granule, e.g. 64 so that no two pieces write to the same word of a BitMask.
+template<typename Work> void ParallelRanges(std::size_t n, unsigned int threads, Work work, std::size_t granule=1) {
+    if (threads==1 || n<2*ParallelMinimum) {
+        work((std::size_t)0,n);
+    return;
+    }
+    ThreadPool& pool=ThreadPool::Default();
+    std::size_t chunk=std::max(ParallelMinimum,n/(8*(std::size_t)pool.size()));
+    pool.Run(n,(chunk+granule-1)/granule*granule,work,threads);
+}
+
+} // namespace RaylibOps
+
+// ********************************************
+//
+//           BATCHED TRANSFORMS
+//
+// ********************************************
+// RaylibOps::TransformPoints(m,in,out,n) gives out[i]=m*in[i] for n points, with the matrix columns loaded into registers once for the whole span.
+// An overload takes a Vector3Array, whose x, y and z lanes let the transform run a full SIMD register of points per instruction.
+// in and out may be the same.  The arithmetic is that of Vector3Transform(), so results are identical to it point by point unless the compiler fuses its multiply-adds.
+//
+// The last parameter splits large spans across threads: 1 (the default) runs on the calling thread only, 0 uses one thread per hardware thread.
+// Spans are only split into pieces of at least ParallelMinimum points, below which handing work to another thread costs more than it saves.
+namespace RaylibOps {
+
+RAYLIBOPS_INLINE void TransformPointRange(const Matrix& m, const Vector3* in, Vector3* out, std::size_t n) {
+#if defined(RAYLIBOPS_SIMD_AVX) || defined(RAYLIBOPS_SIMD_SSE)
+    __m128 c0=_mm_setr_ps(m.m0,m.m1,m.m2,0.0f), c1=_mm_setr_ps(m.m4,m.m5,m.m6,0.0f), c2=_mm_setr_ps(m.m8,m.m9,m.m10,0.0f), c3=_mm_setr_ps(m.m12,m.m13,m.m14,0.0f);
+    for (std::size_t i=0; i<n; i++) {
+        __m128 r=_mm_add_ps(_mm_mul_ps(c0,_mm_set1_ps(in[i].x)),_mm_mul_ps(c1,_mm_set1_ps(in[i].y)));
+        r=_mm_add_ps(_mm_add_ps(r,_mm_mul_ps(c2,_mm_set1_ps(in[i].z))),c3);
+        _mm_storel_pi((__m64*)&out[i].x,r);  //Store x, y and z only, so out[i+1] is never touched before it is read
+        _mm_store_ss(&out[i].z,_mm_movehl_ps(r,r));
+    }
+#elif defined(RAYLIBOPS_SIMD_NEON)
+    float c[16]={m.m0,m.m1,m.m2,0.0f, m.m4,m.m5,m.m6,0.0f, m.m8,m.m9,m.m10,0.0f, m.m12,m.m13,m.m14,0.0f};
+    float32x4_t c0=vld1q_f32(c), c1=vld1q_f32(c+4), c2=vld1q_f32(c+8), c3=vld1q_f32(c+12);
+    for (std::size_t i=0; i<n; i++) {
+        float32x4_t r=vaddq_f32(vmulq_n_f32(c0,in[i].x),vmulq_n_f32(c1,in[i].y));
+        r=vaddq_f32(vaddq_f32(r,vmulq_n_f32(c2,in[i].z)),c3);
+        vst1_f32(&out[i].x,vget_low_f32(r));
+        vst1q_lane_f32(&out[i].z,r,2);
+    }
+#else
+    const Matrix local=m;  //A copy the stores to out cannot alias, so it stays in registers
+    for (std::size_t i=0; i<n; i++) out[i]=local*in[i];
+#endif
+}
+
+RAYLIBOPS_INLINE void TransformPoints(const Matrix& m, const Vector3* in, Vector3* out, std::size_t n, unsigned int threads=1) {
+    ParallelRanges(n,threads,[&m,in,out](std::size_t begin, std::size_t end) { TransformPointRange(m,in+begin,out+begin,end-begin); });
+}
+
+//One row of the matrix over the x, y and z lanes: out=a*x+b*y+c*z+d
+RAYLIBOPS_INLINE void LanesTransformRow(float a, float b, float c, float d, const float* x, const float* y, const float* z, float* out, std::size_t n) {
+    Simd::Floats va=Simd::Splat(a), vb=Simd::Splat(b), vc=Simd::Splat(c), vd=Simd::Splat(d);
+    std::size_t i=0;
+    for (; i+Simd::FloatWidth<=n; i+=Simd::FloatWidth) {
+        Simd::Floats r=Simd::Add(Simd::Multiply(va,Simd::Load(x+i)),Simd::Multiply(vb,Simd::Load(y+i)));
+        Simd::Store(out+i,Simd::Add(Simd::Add(r,Simd::Multiply(vc,Simd::Load(z+i))),vd));
+    }
+    for (; i<n; i++) out[i]=a*x[i] + b*y[i] + c*z[i] + d;
+}
+
+//out is resized to match in.  Rows go through a small buffer so that in and out may be the same array.
+RAYLIBOPS_INLINE void TransformPoints(const Matrix& m, const Vector3Array& in, Vector3Array& out, unsigned int threads=1) {
+    out.resize(in.size());
+    const float* x=in.Lane(0);
+    const float* y=in.Lane(1);
+    const float* z=in.Lane(2);
+    float* ox=out.Lane(0);
+    float* oy=out.Lane(1);
+    float* oz=out.Lane(2);
+    ParallelRanges(in.size(),threads,[&m,x,y,z,ox,oy,oz](std::size_t begin, std::size_t end) {
+        const std::size_t block=256;
+        alignas(64) float rx[block], ry[block];
+        for (std::size_t i=begin; i<end; i+=block) {
+            std::size_t count=std::min(block,end-i);
+            LanesTransformRow(m.m0,m.m4,m.m8,m.m12,x+i,y+i,z+i,rx,count);
+            LanesTransformRow(m.m1,m.m5,m.m9,m.m13,x+i,y+i,z+i,ry,count);
+            LanesTransformRow(m.m2,m.m6,m.m10,m.m14,x+i,y+i,z+i,oz+i,count);
+            std::memcpy(ox+i,rx,count*sizeof(float));
+            std::memcpy(oy+i,ry,count*sizeof(float));
+        }
+    });
+}
+
+} // namespace RaylibOps
+
+// ********************************************
+//
+//           REDUCTIONS
+//
+// ********************************************
+// RaylibOps::Sum(points,n) adds up n Vector2s, Vector3s or Vector4s, and Mean() divides that by n; both also take a Vector2Array or Vector3Array.
+// ComponentMin() and ComponentMax() give the smallest and largest of each component, and Bounds() the smallest BoundingBox holding n Vector3s (or Rectangle
+// holding n Vector2s), ready for operator<<: std::cout<<RaylibOps::Bounds(cloud.data(),cloud.size()); prints the box of a point cloud.
+//
+// A loop of += waits for each addition before starting the next.  These read the points as one run of floats instead, FloatWidth floats per instruction into
+// two sets of registers, so several additions are in flight at once.  The span is reduced in blocks of ReduceBlock points, each block's total is kept in double,
+// and the block totals are added pairwise, so the rounding error grows with the log of n rather than with n.  Summation::Compensated also carries a Kahan
+// correction for each register within the block, which costs little once the points come from memory; Centroid() is Mean() with it.  Summing 10M points near
+// 1000 with += is off by about 2%, while Fast and Compensated are both within a rounding of the float returned.  Compensated is for points which cancel,
+// where it keeps a small sum accurate that Fast may not.  The compensation is algebraically zero, so -ffast-math or /fp:fast may delete it.
+//
+// The optional thread count is that of TransformPoints.  Blocks are the same whatever the thread count, so are the results, bit for bit.
+// The sum of no points is the zero vector, as is their mean.  Their ComponentMin() is +infinity and ComponentMax() -infinity, so Bounds() of no Vector3s is the
+// inverted box from {+inf,+inf,+inf} to {-inf,-inf,-inf}, which RaylibOps::IsEmpty() reports as empty, and Bounds() of no Vector2s is the Rectangle {0,0,0,0}.  Whether a NaN component is skipped or returned by the minimum and maximum
+// depends on the instruction set.
+namespace RaylibOps {
+
+enum class Summation { Fast, Compensated };
+
+const std::size_t ReduceBlock=1024;
+
+//Results for each block: on the stack for short spans, so that they need no allocation
+template<typename T> class BlockPartials {
+public:
+    BlockPartials(std::size_t n, T fill) : data(local) {
+        if (n>LocalCount) {
+            heap.assign(n,fill);
+            data=heap.data();
+        }
+        else std::fill(local,local+n,fill);
+    }
+    BlockPartials(const BlockPartials&)=delete;
+    BlockPartials& operator=(const BlockPartials&)=delete;
+    T& operator[](std::size_t i) { return data[i]; }
+
+private:
+    static const std::size_t LocalCount=64;
+    T local[LocalCount];
+    std::vector<T> heap;
+    T* data;
+};
+
+//Per-point kernels.  Each step loads K=2*D/gcd(D,FloatWidth) registers of consecutive floats, two whole periods of the component pattern: lane j of register k
+//holds component (k*FloatWidth+j)%D.  The registers are expanded from an index_sequence rather than looped over, so that they stay in registers.
+template<int D> constexpr int ReduceRegisters() { return 2*D/std::gcd(D,Simd::FloatWidth); }
+
+template<int D> void FoldLanes(Simd::Floats sum, Simd::Floats carry, int k, double* out) {
+    alignas(64) float s[Simd::FloatWidth], c[Simd::FloatWidth];
+    Simd::Store(s,sum);
+    Simd::Store(c,carry);
+    for (int j=0; j<Simd::FloatWidth; j++) out[(k*Simd::FloatWidth+j)%D]+=(double)s[j]-(double)c[j];
+}
+
+template<int D> void FoldLanes(Simd::Floats low, Simd::Floats high, int k, float* lo, float* hi) {
+    alignas(64) float l[Simd::FloatWidth], h[Simd::FloatWidth];
+    Simd::Store(l,low);
+    Simd::Store(h,high);
+    for (int j=0; j<Simd::FloatWidth; j++) {
+        int c=(k*Simd::FloatWidth+j)%D;
+        lo[c]=std::min(lo[c],l[j]);
+        hi[c]=std::max(hi[c],h[j]);
+    }
+}
+
+template<int D, std::size_t... k> void SumRangeExpand(const float* p, std::size_t count, Summation mode, double* out, std::index_sequence<k...>) {
+    const std::size_t step=sizeof...(k)*Simd::FloatWidth;
+    const std::size_t floats=count*D;
+    Simd::Floats sum[]={((void)k,Simd::Splat(0.0f))...};
+    Simd::Floats carry[]={((void)k,Simd::Splat(0.0f))...};
+    std::size_t i=0;
+    if (mode==Summation::Fast) {
+        for (; i+step<=floats; i+=step) ((sum[k]=Simd::Add(sum[k],Simd::Load(p+i+k*Simd::FloatWidth))), ...);
+    }
+    else {
+        for (; i+step<=floats; i+=step) {
+            Simd::Floats y[]={Simd::Subtract(Simd::Load(p+i+k*Simd::FloatWidth),carry[k])...};
+            Simd::Floats t[]={Simd::Add(sum[k],y[k])...};
+            ((carry[k]=Simd::Subtract(Simd::Subtract(t[k],sum[k]),y[k])), ...);
+            ((sum[k]=t[k]), ...);
+        }
+    }
+    (FoldLanes<D>(sum[k],carry[k],(int)k,out), ...);
+    for (; i<floats; i++) out[i%D]+=p[i];  //i starts on a multiple of D
+}
+
+template<int D, std::size_t... k> void BoundsRangeExpand(const float* p, std::size_t count, float* lo, float* hi, std::index_sequence<k...>) {
+    const std::size_t step=sizeof...(k)*Simd::FloatWidth;
+    const std::size_t floats=count*D;
+    Simd::Floats low[]={((void)k,Simd::Splat(std::numeric_limits<float>::infinity()))...};
+    Simd::Floats high[]={((void)k,Simd::Splat(-std::numeric_limits<float>::infinity()))...};
+    std::size_t i=0;
+    for (; i+step<=floats; i+=step) {
+        Simd::Floats x[]={Simd::Load(p+i+k*Simd::FloatWidth)...};
+        ((low[k]=Simd::Min(x[k],low[k])), ...);
+        ((high[k]=Simd::Max(x[k],high[k])), ...);
+    }
+    (FoldLanes<D>(low[k],high[k],(int)k,lo,hi), ...);
+    for (; i<floats; i++) {
+        lo[i%D]=std::min(lo[i%D],p[i]);
+        hi[i%D]=std::max(hi[i%D],p[i]);
+    }
+}
+
+//Adds count points of D floats each to out[0..D)
+template<int D> void SumRange(const float* p, std::size_t count, Summation mode, double* out) {
+    SumRangeExpand<D>(p,count,mode,out,std::make_index_sequence<ReduceRegisters<D>()>());
+}
+
+//Lowers lo[0..D) and raises hi[0..D) to take in count points of D floats each
+template<int D> void BoundsRange(const float* p, std::size_t count, float* lo, float* hi) {
+    BoundsRangeExpand<D>(p,count,lo,hi,std::make_index_sequence<ReduceRegisters<D>()>());
+}
+
+//block(begin,count,partial) adds points [begin,begin+count) to its D doubles.  The block partials are then added pairwise, in the same order for any thread count.
+template<int D, typename Block> void SumBlocks(std::size_t n, unsigned int threads, double* total, Block block) {
+    std::size_t blocks=(n+ReduceBlock-1)/ReduceBlock;
+    BlockPartials<double> partials(std::max<std::size_t>(blocks,1)*D,0.0);
+    ParallelRanges(n,threads,[&partials,&block](std::size_t begin, std::size_t end) {
+        for (std::size_t i=begin; i<end; i+=ReduceBlock) block(i,std::min(ReduceBlock,end-i),&partials[i/ReduceBlock*D]);
+    },ReduceBlock);
+    for (std::size_t stride=1; stride<blocks; stride*=2) {
+        for (std::size_t b=0; b+stride<blocks; b+=2*stride) {
+            for (int c=0; c<D; c++) partials[b*D+c]+=partials[(b+stride)*D+c];
+        }
+    }
+    for (int c=0; c<D; c++) total[c]=partials[c];
+}
+
+//block(begin,count,lo,hi) takes points [begin,begin+count) into its D lows and highs, starting from +-infinity
+template<int D, typename Block> void BoundsBlocks(std::size_t n, unsigned int threads, float* lo, float* hi, Block block) {
+    const float infinity=std::numeric_limits<float>::infinity();
+    std::size_t blocks=(n+ReduceBlock-1)/ReduceBlock;
+    BlockPartials<float> partials(blocks*2*D,infinity);
+    for (std::size_t b=0; b<blocks; b++) {
+        for (int c=0; c<D; c++) partials[b*2*D+D+c]=-infinity;
+    }
+    ParallelRanges(n,threads,[&partials,&block](std::size_t begin, std::size_t end) {
+        for (std::size_t i=begin; i<end; i+=ReduceBlock) {
+            float* partial=&partials[i/ReduceBlock*2*D];
+            block(i,std::min(ReduceBlock,end-i),partial,partial+D);
+        }
+    },ReduceBlock);
+    for (int c=0; c<D; c++) {
+        lo[c]=infinity;
+        hi[c]=-infinity;
+    }
+    for (std::size_t b=0; b<blocks; b++) {
+        for (int c=0; c<D; c++) {
+            lo[c]=std::min(lo[c],partials[b*2*D+c]);
+            hi[c]=std::max(hi[c],partials[b*2*D+D+c]);
+        }
+    }
+}
+
+template<typename V, typename T> V VectorFromComponents(const T* c) {
+    V v{};
+    for (int i=0; i<VectorTraits<V>::Dimension; i++) v.*VectorTraits<V>::Components[i]=(float)c[i];
+return v;
+}
+
+//Sums reduce the points as a flat run of floats, which needs V to be exactly its components
+template<typename V> void SumPoints(const V* points, std::size_t n, Summation mode, unsigned int threads, double* total) {
+    const int D=VectorTraits<V>::Dimension;
+    static_assert(sizeof(V)==D*sizeof(float), "Reductions need vectors without padding");
+    const float* p=reinterpret_cast<const float*>(points);
+    SumBlocks<D>(n,threads,total,[p,mode](std::size_t begin, std::size_t count, double* partial) { SumRange<D>(p+begin*D,count,mode,partial); });
+}
+
+template<typename V> void SumPoints(const VectorArray<V>& points, Summation mode, unsigned int threads, double* total) {
+    const int D=VectorArray<V>::Dimension;
+    const float* lanes[D];
+    for (int c=0; c<D; c++) lanes[c]=points.Lane(c);
+    SumBlocks<D>(points.size(),threads,total,[&lanes,mode](std::size_t begin, std::size_t count, double* partial) {
+        for (int c=0; c<D; c++) SumRange<1>(lanes[c]+begin,count,mode,partial+c);
+    });
+}
+
+template<typename V> void BoundPoints(const V* points, std::size_t n, unsigned int threads, float* lo, float* hi) {
+    const int D=VectorTraits<V>::Dimension;
+    static_assert(sizeof(V)==D*sizeof(float), "Reductions need vectors without padding");
+    const float* p=reinterpret_cast<const float*>(points);
+    BoundsBlocks<D>(n,threads,lo,hi,[p](std::size_t begin, std::size_t count, float* blo, float* bhi) { BoundsRange<D>(p+begin*D,count,blo,bhi); });
+}
+
+template<typename V> void BoundPoints(const VectorArray<V>& points, unsigned int threads, float* lo, float* hi) {
+    const int D=VectorArray<V>::Dimension;
+    const float* lanes[D];
+    for (int c=0; c<D; c++) lanes[c]=points.Lane(c);
+    BoundsBlocks<D>(points.size(),threads,lo,hi,[&lanes](std::size_t begin, std::size_t count, float* blo, float* bhi) {
+        for (int c=0; c<D; c++) BoundsRange<1>(lanes[c]+begin,count,blo+c,bhi+c);
+    });
+}
+
+template<typename V> FloatVector<V> Sum(const V* points, std::size_t n, Summation mode=Summation::Fast, unsigned int threads=1) {
+    double total[4];
+    SumPoints(points,n,mode,threads,total);
+return VectorFromComponents<V>(total);
+}
+
+template<typename V> V Sum(const VectorArray<V>& points, Summation mode=Summation::Fast, unsigned int threads=1) {
+    double total[4];
+    SumPoints(points,mode,threads,total);
+return VectorFromComponents<V>(total);
+}
+
+template<typename V> FloatVector<V> Mean(const V* points, std::size_t n, Summation mode=Summation::Fast, unsigned int threads=1) {
+    double total[4];
+    SumPoints(points,n,mode,threads,total);
+    for (int c=0; c<VectorTraits<V>::Dimension; c++) total[c]=(n>0)?total[c]/(double)n:0.0;
+return VectorFromComponents<V>(total);
+}
+
+template<typename V> V Mean(const VectorArray<V>& points, Summation mode=Summation::Fast, unsigned int threads=1) {
+    double total[4];
+    SumPoints(points,mode,threads,total);
+    for (int c=0; c<VectorArray<V>::Dimension; c++) total[c]=(points.size()>0)?total[c]/(double)points.size():0.0;
+return VectorFromComponents<V>(total);
+}
+
+template<typename V> FloatVector<V> Centroid(const V* points, std::size_t n, unsigned int threads=1) {
+return Mean(points,n,Summation::Compensated,threads);
+}
+
+template<typename V> V Centroid(const VectorArray<V>& points, unsigned int threads=1) {
+return Mean(points,Summation::Compensated,threads);
+}
+
+template<typename V> FloatVector<V> ComponentMin(const V* points, std::size_t n, unsigned int threads=1) {
+    float lo[4], hi[4];
+    BoundPoints(points,n,threads,lo,hi);
+return VectorFromComponents<V>(lo);
+}
+
+template<typename V> V ComponentMin(const VectorArray<V>& points, unsigned int threads=1) {
+    float lo[4], hi[4];
+    BoundPoints(points,threads,lo,hi);
+return VectorFromComponents<V>(lo);
+}
+
+template<typename V> FloatVector<V> ComponentMax(const V* points, std::size_t n, unsigned int threads=1) {
+    float lo[4], hi[4];
+    BoundPoints(points,n,threads,lo,hi);
+return VectorFromComponents<V>(hi);
+}
+
+template<typename V> V ComponentMax(const VectorArray<V>& points, unsigned int threads=1) {
+    float lo[4], hi[4];
+    BoundPoints(points,threads,lo,hi);
+return VectorFromComponents<V>(hi);
+}
+
+RAYLIBOPS_INLINE BoundingBox Bounds(const Vector3* points, std::size_t n, unsigned int threads=1) {
+    float lo[3], hi[3];
+    BoundPoints(points,n,threads,lo,hi);
+return BoundingBox{{lo[0],lo[1],lo[2]},{hi[0],hi[1],hi[2]}};
+}
+
+RAYLIBOPS_INLINE BoundingBox Bounds(const Vector3Array& points, unsigned int threads=1) {
+    float lo[3], hi[3];
+    BoundPoints(points,threads,lo,hi);
+return BoundingBox{{lo[0],lo[1],lo[2]},{hi[0],hi[1],hi[2]}};
+}
+
+RAYLIBOPS_INLINE Rectangle Bounds(const Vector2* points, std::size_t n, unsigned int threads=1) {
+    if (n==0) return Rectangle{0.0f,0.0f,0.0f,0.0f};
+    float lo[2], hi[2];
+    BoundPoints(points,n,threads,lo,hi);
+return Rectangle{lo[0],lo[1],hi[0]-lo[0],hi[1]-lo[1]};
+}
+
+RAYLIBOPS_INLINE Rectangle Bounds(const Vector2Array& points, unsigned int threads=1) {
+    if (points.size()==0) return Rectangle{0.0f,0.0f,0.0f,0.0f};
+    float lo[2], hi[2];
+    BoundPoints(points,threads,lo,hi);
+return Rectangle{lo[0],lo[1],hi[0]-lo[0],hi[1]-lo[1]};
+}
+
+} // namespace RaylibOps
+
+// ********************************************
+//
+//           QUATERNIONS
+//
+// ********************************************
+// Since Quaternion is only a typedef of Vector4, the operators above treat it as a plain 4D vector.  RaylibOps::Quat is a separate type with the same layout
+// (four floats x, y, z, w) for which the operators mean quaternion operations:
+//   q1*q2      Hamilton product, as raymath's QuaternionMultiply(q1,q2)
+//   -q         negation of every component: the same rotation from the other hemisphere.  Conjugate(q) gives the inverse rotation of a unit quaternion.
+//   q*v        rotation of a Vector3, as Vector3RotateByQuaternion(v,q)
+//   q1+q2, q1-q2, q*s   component-wise, as building blocks for blending
+// A Quat converts implicitly to a Quaternion, so it can be passed to any raylib function, and explicitly from one: RaylibOps::Quat q(QuaternionFromEuler(...));
+//
+// Nlerp(a,b,t) and Slerp(a,b,t) interpolate along the shorter arc.  NlerpQuats and SlerpQuats blend whole arrays of joints, with a single weight or one per joint.
+// NlerpQuats transposes FloatWidth joints at a time into SIMD registers; SlerpQuats is one call for the array but its trigonometry is per joint.
+// Like TransformPoints, both take an optional thread count.
+namespace RaylibOps {
+
+struct Quat {
+    float x, y, z, w;
+
+    Quat() = default;
+    constexpr Quat(float x_, float y_, float z_, float w_) : x(x_), y(y_), z(z_), w(w_) {}
+    constexpr explicit Quat(const Quaternion& q) : x(q.x), y(q.y), z(q.z), w(q.w) {}
+    constexpr operator Quaternion() const { return Quaternion{x,y,z,w}; }
+
+    static constexpr Quat Identity() { return Quat(0.0f,0.0f,0.0f,1.0f); }
+};
+
+static_assert(sizeof(Quat)==sizeof(Vector4) && alignof(Quat)==alignof(Vector4) && std::is_standard_layout<Quat>::value && std::is_trivially_copyable<Quat>::value,
+              "Quat must have the layout of Vector4");
+
+RAYLIBOPS_CONSTEXPR Quat operator*(const Quat& a, const Quat& b) {
+return Quat(a.x*b.w + a.w*b.x + a.y*b.z - a.z*b.y, a.y*b.w + a.w*b.y + a.z*b.x - a.x*b.z, a.z*b.w + a.w*b.z + a.x*b.y - a.y*b.x, a.w*b.w - a.x*b.x - a.y*b.y - a.z*b.z);
+}
+
+RAYLIBOPS_CONSTEXPR Quat& operator*=(Quat& a, const Quat& b) {
+    a=a*b;
+return a;
+}
+
+RAYLIBOPS_CONSTEXPR Quat operator-(const Quat& q) {
+return Quat(-q.x,-q.y,-q.z,-q.w);
+}
+
+RAYLIBOPS_CONSTEXPR Quat Conjugate(const Quat& q) {
+return Quat(-q.x,-q.y,-q.z,q.w);
+}
+
+RAYLIBOPS_CONSTEXPR Quat operator+(const Quat& a, const Quat& b) {
+return Quat(a.x+b.x,a.y+b.y,a.z+b.z,a.w+b.w);
+}
+
+RAYLIBOPS_CONSTEXPR Quat operator-(const Quat& a, const Quat& b) {
+return Quat(a.x-b.x,a.y-b.y,a.z-b.z,a.w-b.w);
+}
+
+RAYLIBOPS_CONSTEXPR Quat operator*(const Quat& q, float s) {
+return Quat(q.x*s,q.y*s,q.z*s,q.w*s);
+}
+
+RAYLIBOPS_CONSTEXPR float Dot(const Quat& a, const Quat& b) {
+return a.x*b.x + a.y*b.y + a.z*b.z + a.w*b.w;
+}
+
+//Rotates v; the same formula as Vector3RotateByQuaternion(v,q), which expects q to be normalized
+RAYLIBOPS_CONSTEXPR Vector3 operator*(const Quat& q, const Vector3& v) {
+return Vector3{v.x*(q.x*q.x + q.w*q.w - q.y*q.y - q.z*q.z) + v.y*(2*q.x*q.y - 2*q.w*q.z) + v.z*(2*q.x*q.z + 2*q.w*q.y),
+               v.x*(2*q.w*q.z + 2*q.x*q.y) + v.y*(q.w*q.w - q.x*q.x + q.y*q.y - q.z*q.z) + v.z*(-2*q.w*q.x + 2*q.y*q.z),
+               v.x*(-2*q.w*q.y + 2*q.x*q.z) + v.y*(2*q.w*q.x + 2*q.y*q.z) + v.z*(q.w*q.w - q.x*q.x - q.y*q.y + q.z*q.z)};
+}
+
+//A zero quaternion stays zero, as with QuaternionNormalize()
+RAYLIBOPS_INLINE Quat Normalize(const Quat& q) {
+    float length=std::max(std::sqrt(q.x*q.x + q.y*q.y + q.z*q.z + q.w*q.w),std::numeric_limits<float>::min());
+return q*(1.0f/length);
+}
+
+//Normalized linear interpolation.  Unlike QuaternionNlerp(), b is negated when that is closer to a, so the blend takes the shorter arc.
+RAYLIBOPS_INLINE Quat Nlerp(const Quat& a, const Quat& b, float t) {
+    Quat closer=b*std::copysign(1.0f,Dot(a,b));  //Multiplying by -1 rather than branching: the sign is as unpredictable as the joints are
+return Normalize(a+(closer-a)*t);
+}
+
+//Spherical linear interpolation, the same algorithm as raymath's QuaternionSlerp()
+RAYLIBOPS_INLINE Quat Slerp(const Quat& a, const Quat& b, float t) {
+    float cosHalfTheta=Dot(a,b);
+    Quat closer=b;
+    if (cosHalfTheta<0) {
+        closer=-b;
+        cosHalfTheta=-cosHalfTheta;
+    }
+    if (cosHalfTheta>=1.0f) return a;
+    if (cosHalfTheta>0.95f) return Nlerp(a,closer,t);
+    float halfTheta=std::acos(cosHalfTheta);
+    float sinHalfTheta=std::sqrt(1.0f-cosHalfTheta*cosHalfTheta);
+    if (std::fabs(sinHalfTheta)<0.001f) return a*0.5f+closer*0.5f;
+return a*(std::sin((1-t)*halfTheta)/sinHalfTheta)+closer*(std::sin(t*halfTheta)/sinHalfTheta);
+}
+
+//FloatWidth joints per step, with the weight splatted or loaded per joint.  The lane arithmetic is that of Nlerp(), so the tail gives the same results.
+template<bool PerJoint> void NlerpQuatRange(const Quat* a, const Quat* b, const float* t, Quat* out, std::size_t n) {
+    Simd::Floats tiny=Simd::Splat(std::numeric_limits<float>::min()), one=Simd::Splat(1.0f);
+    std::size_t i=0;
+    for (; i+Simd::FloatWidth<=n; i+=Simd::FloatWidth) {
+        Simd::Floats ax, ay, az, aw, bx, by, bz, bw;
+        Simd::LoadQuads(&a[i].x,ax,ay,az,aw);
+        Simd::LoadQuads(&b[i].x,bx,by,bz,bw);
+        Simd::Floats weight=PerJoint?Simd::Load(t+i):Simd::Splat(*t);
+        Simd::Floats d=Simd::Add(Simd::Add(Simd::Add(Simd::Multiply(ax,bx),Simd::Multiply(ay,by)),Simd::Multiply(az,bz)),Simd::Multiply(aw,bw));
+        Simd::Floats rx=Simd::Add(ax,Simd::Multiply(Simd::Subtract(Simd::FlipSign(bx,d),ax),weight));
+        Simd::Floats ry=Simd::Add(ay,Simd::Multiply(Simd::Subtract(Simd::FlipSign(by,d),ay),weight));
+        Simd::Floats rz=Simd::Add(az,Simd::Multiply(Simd::Subtract(Simd::FlipSign(bz,d),az),weight));
+        Simd::Floats rw=Simd::Add(aw,Simd::Multiply(Simd::Subtract(Simd::FlipSign(bw,d),aw),weight));
+        Simd::Floats length2=Simd::Add(Simd::Add(Simd::Add(Simd::Multiply(rx,rx),Simd::Multiply(ry,ry)),Simd::Multiply(rz,rz)),Simd::Multiply(rw,rw));
+        Simd::Floats inverse=Simd::Divide(one,Simd::Max(tiny,Simd::Sqrt(length2)));  //A NaN length stays NaN, as with std::max() in Normalize(): maxps returns its second operand
+        Simd::StoreQuads(&out[i].x,Simd::Multiply(rx,inverse),Simd::Multiply(ry,inverse),Simd::Multiply(rz,inverse),Simd::Multiply(rw,inverse));
+    }
+    for (; i<n; i++) out[i]=Nlerp(a[i],b[i],PerJoint?t[i]:*t);
+}
+
+//out[i]=Nlerp(a[i],b[i],t).  out may be a or b.
+RAYLIBOPS_INLINE void NlerpQuats(const Quat* a, const Quat* b, float t, Quat* out, std::size_t n, unsigned int threads=1) {
+    ParallelRanges(n,threads,[=](std::size_t begin, std::size_t end) { NlerpQuatRange<false>(a+begin,b+begin,&t,out+begin,end-begin); });
+}
+
+//out[i]=Nlerp(a[i],b[i],t[i])
+RAYLIBOPS_INLINE void NlerpQuats(const Quat* a, const Quat* b, const float* t, Quat* out, std::size_t n, unsigned int threads=1) {
+    ParallelRanges(n,threads,[=](std::size_t begin, std::size_t end) { NlerpQuatRange<true>(a+begin,b+begin,t+begin,out+begin,end-begin); });
+}
+
+//out[i]=Slerp(a[i],b[i],t)
+RAYLIBOPS_INLINE void SlerpQuats(const Quat* a, const Quat* b, float t, Quat* out, std::size_t n, unsigned int threads=1) {
+    ParallelRanges(n,threads,[=](std::size_t begin, std::size_t end) { for (std::size_t i=begin; i<end; i++) out[i]=Slerp(a[i],b[i],t); });
+}
+
+//out[i]=Slerp(a[i],b[i],t[i])
+RAYLIBOPS_INLINE void SlerpQuats(const Quat* a, const Quat* b, const float* t, Quat* out, std::size_t n, unsigned int threads=1) {
+    ParallelRanges(n,threads,[=](std::size_t begin, std::size_t end) { for (std::size_t i=begin; i<end; i++) out[i]=Slerp(a[i],b[i],t[i]); });
+}
+
+} // namespace RaylibOps
+
+// ********************************************
+//
+//           BATCHED INTERSECTION TESTS
+//
+// ********************************************
+// BoxArray stores many BoundingBoxes as two Vector3Arrays, min and max, so that each corner coordinate has a lane of its own.
+// RaylibOps::OverlapMask(query,boxes) tests one BoundingBox against all of them: bit i of the returned BitMask is set if CheckCollisionBoxes(query,boxes[i]) would be true.
+// RaylibOps::OverlapMask(frustum,boxes) does the same against the six planes of a view frustum, for culling: bit i is set unless boxes[i] lies wholly outside one of the planes.
+// As with most frustum culling this is conservative.  A box just outside an edge or corner of the frustum may still be reported as visible, but never the reverse.
+// Both test FloatWidth boxes per instruction and take the same optional thread count as TransformPoints.  Overloads on a plain array of BoundingBoxes test one box at a time.
+//
+// Frustum::FromMatrix(view*projection) extracts the planes from a camera's combined matrix, e.g. MatrixLookAt(eye,target,up)*MatrixPerspective(fovy,aspect,near,far).
+namespace RaylibOps {
+
+//Each plane a*x+b*y+c*z+d=0 is stored as Vector4{a,b,c,d}, with (a,b,c) a unit normal pointing into the frustum
+struct Frustum {
+    enum { Left, Right, Bottom, Top, Near, Far };
+    Vector4 planes[6];
+
+    //Gribb and Hartmann's method, for a matrix which maps the frustum onto OpenGL's clip volume -w<=x,y,z<=w
+    static Frustum FromMatrix(const Matrix& m) {
+        const Vector4 rows[4]={Vector4{m.m0,m.m4,m.m8,m.m12}, Vector4{m.m1,m.m5,m.m9,m.m13}, Vector4{m.m2,m.m6,m.m10,m.m14}, Vector4{m.m3,m.m7,m.m11,m.m15}};
+        Frustum f;
+        for (int i=0; i<6; i++) {
+            const Vector4& r=rows[i/2];
+            float s=(i%2==0)?1.0f:-1.0f;  //Left, Bottom and Near are w+row, the others w-row
+            Vector4 p{rows[3].x+s*r.x, rows[3].y+s*r.y, rows[3].z+s*r.z, rows[3].w+s*r.w};
+            float length=std::sqrt(p.x*p.x + p.y*p.y + p.z*p.z);
+            f.planes[i]=Vector4{p.x/length, p.y/length, p.z/length, p.w/length};
+        }
+    return f;
+    }
+};
+
+//Signed distance from the plane to the corner of b furthest along its normal
+RAYLIBOPS_CONSTEXPR float FurthestDistance(const Vector4& plane, const BoundingBox& b) {
+return plane.x*((plane.x>=0.0f)?b.max.x:b.min.x) + plane.y*((plane.y>=0.0f)?b.max.y:b.min.y) + plane.z*((plane.z>=0.0f)?b.max.z:b.min.z) + plane.w;
+}
+
+RAYLIBOPS_CONSTEXPR bool Overlaps(const Frustum& f, const BoundingBox& b) {
+    for (int i=0; i<6; i++) {
+        if (!(FurthestDistance(f.planes[i],b)>=0.0f)) return false;
+    }
+return true;
+}
+
+class BoxArray {
+public:
+    BoxArray() {}
+
+    explicit BoxArray(std::size_t n, const BoundingBox& fill=BoundingBox{}) : min(n,fill.min), max(n,fill.max) {}
+
+    BoxArray(const std::vector<BoundingBox>& boxes) : min(boxes.size()), max(boxes.size()) {
+        for (std::size_t i=0; i<boxes.size(); i++) Set(i,boxes[i]);
+    }
+
+    std::vector<BoundingBox> ToStdVector() const {
+        std::vector<BoundingBox> v(size());
+        for (std::size_t i=0; i<v.size(); i++) v[i]=(*this)[i];
+    return v;
+    }
+
+    std::size_t size() const { return min.size(); }
+
+    void resize(std::size_t n) {
+        min.resize(n);
+        max.resize(n);
+    }
+
+    BoundingBox operator[](std::size_t i) const { return BoundingBox{min[i],max[i]}; }
+
+    void Set(std::size_t i, const BoundingBox& b) {
+        min.Set(i,b.min);
+        max.Set(i,b.max);
+    }
+
+    Vector3Array min;
+    Vector3Array max;
+};
+
+RAYLIBOPS_INLINE void OverlapRange(const BoundingBox& query, const BoxArray& boxes, BitMask& mask, std::size_t begin, std::size_t end) {
+    const float* lo[3]={boxes.min.Lane(0), boxes.min.Lane(1), boxes.min.Lane(2)};
+    const float* hi[3]={boxes.max.Lane(0), boxes.max.Lane(1), boxes.max.Lane(2)};
+    const Simd::Floats qlo[3]={Simd::Splat(query.min.x), Simd::Splat(query.min.y), Simd::Splat(query.min.z)};
+    const Simd::Floats qhi[3]={Simd::Splat(query.max.x), Simd::Splat(query.max.y), Simd::Splat(query.max.z)};
+    const unsigned int all=(1u<<Simd::FloatWidth)-1;
+    std::size_t i=begin;
+    for (; i+Simd::FloatWidth<=end; i+=Simd::FloatWidth) {
+        unsigned int lanes=all;
+        for (int c=0; c<3; c++) lanes&=Simd::LessEqualBits(qlo[c],Simd::Load(hi[c]+i)) & Simd::LessEqualBits(Simd::Load(lo[c]+i),qhi[c]);
+        mask.SetLanes(i,lanes);
+    }
+    for (; i<end; i++) mask.Set(i,Overlaps(query,boxes[i]));
+}
+
+RAYLIBOPS_INLINE void OverlapRange(const Frustum& frustum, const BoxArray& boxes, BitMask& mask, std::size_t begin, std::size_t end) {
+    //The choice of corner depends only on the signs of the plane's normal, so each plane reads whole lanes of either min or max
+    const float* corner[6][3];
+    Simd::Floats a[6], b[6], c[6], d[6];
+    for (int p=0; p<6; p++) {
+        const Vector4& plane=frustum.planes[p];
+        corner[p][0]=((plane.x>=0.0f)?boxes.max:boxes.min).Lane(0);
+        corner[p][1]=((plane.y>=0.0f)?boxes.max:boxes.min).Lane(1);
+        corner[p][2]=((plane.z>=0.0f)?boxes.max:boxes.min).Lane(2);
+        a[p]=Simd::Splat(plane.x);
+        b[p]=Simd::Splat(plane.y);
+        c[p]=Simd::Splat(plane.z);
+        d[p]=Simd::Splat(plane.w);
+    }
+    const Simd::Floats zero=Simd::Splat(0.0f);
+    const unsigned int all=(1u<<Simd::FloatWidth)-1;
+    std::size_t i=begin;
+    for (; i+Simd::FloatWidth<=end; i+=Simd::FloatWidth) {
+        unsigned int lanes=all;
+        for (int p=0; p<6; p++) {
+            Simd::Floats r=Simd::Add(Simd::Multiply(a[p],Simd::Load(corner[p][0]+i)),Simd::Multiply(b[p],Simd::Load(corner[p][1]+i)));
+            lanes&=Simd::LessEqualBits(zero,Simd::Add(Simd::Add(r,Simd::Multiply(c[p],Simd::Load(corner[p][2]+i))),d[p]));
+        }
+        mask.SetLanes(i,lanes);
+    }
+    for (; i<end; i++) mask.Set(i,Overlaps(frustum,boxes[i]));
+}
+
+//Pieces handed to other threads start on a multiple of 64 boxes, so that each writes its own words of the mask
+RAYLIBOPS_INLINE BitMask OverlapMask(const BoundingBox& query, const BoxArray& boxes, unsigned int threads=1) {
+    BitMask mask(boxes.size());
+    ParallelRanges(boxes.size(),threads,[&query,&boxes,&mask](std::size_t begin, std::size_t end) { OverlapRange(query,boxes,mask,begin,end); },64);
+return mask;
+}
+
+RAYLIBOPS_INLINE BitMask OverlapMask(const Frustum& frustum, const BoxArray& boxes, unsigned int threads=1) {
+    BitMask mask(boxes.size());
+    ParallelRanges(boxes.size(),threads,[&frustum,&boxes,&mask](std::size_t begin, std::size_t end) { OverlapRange(frustum,boxes,mask,begin,end); },64);
+return mask;
+}
+
+RAYLIBOPS_INLINE BitMask OverlapMask(const BoundingBox& query, const BoundingBox* boxes, std::size_t n) {
+    BitMask mask(n);
+    for (std::size_t i=0; i<n; i++) mask.Set(i,Overlaps(query,boxes[i]));
+return mask;
+}
+
+RAYLIBOPS_INLINE BitMask OverlapMask(const Frustum& frustum, const BoundingBox* boxes, std::size_t n) {
+    BitMask mask(n);
+    for (std::size_t i=0; i<n; i++) mask.Set(i,Overlaps(frustum,boxes[i]));
+return mask;
+}
+
+} // namespace RaylibOps
+
+// ********************************************
+//
+//           CAMERA SNAPSHOTS
+//
+// ********************************************
+// A CameraSnapshot caches the matrices of a Camera3D for a frame.  Call Update(camera) once per frame, then read View(), Projection(), ViewProjection() and ViewFrustum()
+// as often as needed, e.g. OverlapMask(snapshot.ViewFrustum(),boxes) for culling.  Update() only recomputes them if the camera's position, target, up, fovy or
+// projection mode changed, or the aspect ratio or clip distances were set since; it returns whether it did, and Changed() reports the same until the next Update(),
+// so results which depend only on the camera, such as a visibility mask, can be kept for as long as it stays still.
+// Projection() is the matrix BeginMode3D() would load for the given aspect ratio, by default with rlgl's clip distances RL_CULL_DISTANCE_NEAR and RL_CULL_DISTANCE_FAR.
+// CameraSnapshot2D caches GetCameraMatrix2D() the same way.  Both print like the camera they hold, using the cached matrix.
+namespace RaylibOps {
+
+const float DefaultNearPlane=0.01f;  //rlgl's RL_CULL_DISTANCE_NEAR and RL_CULL_DISTANCE_FAR, which raylib.h does not define
+const float DefaultFarPlane=1000.0f;
+
+RAYLIBOPS_CONSTEXPR bool SameCamera(const Camera3D& a, const Camera3D& b) {
+return a.position.x==b.position.x && a.position.y==b.position.y && a.position.z==b.position.z && a.target.x==b.target.x && a.target.y==b.target.y && a.target.z==b.target.z
+    && a.up.x==b.up.x && a.up.y==b.up.y && a.up.z==b.up.z && a.fovy==b.fovy && a.projection==b.projection;
+}
+
+RAYLIBOPS_CONSTEXPR bool SameCamera(const Camera2D& a, const Camera2D& b) {
+return a.offset.x==b.offset.x && a.offset.y==b.offset.y && a.target.x==b.target.x && a.target.y==b.target.y && a.rotation==b.rotation && a.zoom==b.zoom;
+}
+
+class CameraSnapshot {
+public:
+    explicit CameraSnapshot(float aspect=1.0f, float nearPlane=DefaultNearPlane, float farPlane=DefaultFarPlane)
+        : camera(), view(), projection(), viewProjection(), frustum(), aspect(aspect), nearPlane(nearPlane), farPlane(farPlane), stale(true), changed(false) {}
+
+    bool Update(const Camera3D& c) {
+        changed=stale || !SameCamera(c,camera);
+        if (changed) {
+            camera=c;
+            view=GetCameraMatrix(c);
+            if (c.projection==CAMERA_ORTHOGRAPHIC) {
+                double top=c.fovy/2.0, right=top*aspect;
+                projection=MatrixOrtho(-right,right,-top,top,nearPlane,farPlane);
+            }
+            else {
+                double top=nearPlane*std::tan(c.fovy*0.5*DEG2RAD), right=top*aspect;
+                projection=MatrixFrustum(-right,right,-top,top,nearPlane,farPlane);
+            }
+            viewProjection=view*projection;
+            frustum=Frustum::FromMatrix(viewProjection);
+            stale=false;
+        }
+    return changed;
+    }
+
+    //Width over height of the render target, e.g. (float)GetScreenWidth()/GetScreenHeight()
+    void SetAspect(float a) {
+        aspect=a;
+        stale=true;
+    }
+
+    void SetClipPlanes(float n, float f) {
+        nearPlane=n;
+        farPlane=f;
+        stale=true;
+    }
+
+    bool Changed() const { return changed; }
+    const Camera3D& GetCamera() const { return camera; }
+    const Matrix& View() const { return view; }
+    const Matrix& Projection() const { return projection; }
+    const Matrix& ViewProjection() const { return viewProjection; }  //View() followed by Projection(): world to clip coordinates
+    const Frustum& ViewFrustum() const { return frustum; }
+
+private:
+    Camera3D camera;
+    Matrix view;
+    Matrix projection;
+    Matrix viewProjection;
+    Frustum frustum;
+    float aspect;
+    float nearPlane;
+    float farPlane;
+    bool stale;
+    bool changed;
+};
+
+class CameraSnapshot2D {
+public:
+    CameraSnapshot2D() : camera(), view(), stale(true), changed(false) {}
+
+    bool Update(const Camera2D& c) {
+        changed=stale || !SameCamera(c,camera);
+        if (changed) {
+            camera=c;
+            view=GetCameraMatrix2D(c);
+            stale=false;
+        }
+    return changed;
+    }
+
+    bool Changed() const { return changed; }
+    const Camera2D& GetCamera() const { return camera; }
+    const Matrix& View() const { return view; }
+
+private:
+    Camera2D camera;
+    Matrix view;
+    bool stale;
+    bool changed;
+};
+
+} // namespace RaylibOps
+
+// ********************************************
+//
+//           BATCHED RAY CASTING
+//
+// ********************************************
+// A RayPacket stores many Rays as two Vector3Arrays, position and direction.  RaylibOps::CastRays(rays,boxes,n,hits) finds, for every ray, the closest of n BoundingBoxes
+// it hits and fills hits[i] as raylib's collision functions fill a RayHitInfo: hit, distance along the ray, position and surface normal there.
+// The overload taking centers and radii does the same for spheres.  If hitIndices is given, hitIndices[i] is set to the index of the object hit, or n for none.
+//
+// The rays are cast FloatWidth at a time, one per SIMD lane, with each box or sphere broadcast to all the lanes: the slab test of CheckCollisionRayBox() for boxes and
+// the quadratic of CheckCollisionRaySphere() for spheres.  Objects are treated as solid, so a ray starting inside one hits it at distance 0, with a zero normal.
+// A ray parallel to a box's faces gets CheckCollisionRayBox()'s verdict too, also when it starts exactly on the plane of one.
+// distance is measured in multiples of the ray's direction, which is the true distance when the direction is normalized; the position is always ray*distance.
+// Like TransformPoints, both take an optional thread count, here splitting the rays between threads.
+#include <limits>
+
+namespace RaylibOps {
+
+class RayPacket {
+public:
+    RayPacket() {}
+
+    explicit RayPacket(std::size_t n, const Ray& fill=Ray{}) : position(n,fill.position), direction(n,fill.direction) {}
+
+    RayPacket(const std::vector<Ray>& rays) : position(rays.size()), direction(rays.size()) {
+        for (std::size_t i=0; i<rays.size(); i++) Set(i,rays[i]);
+    }
+
+    std::vector<Ray> ToStdVector() const {
+        std::vector<Ray> v(size());
+        for (std::size_t i=0; i<v.size(); i++) v[i]=(*this)[i];
+    return v;
+    }
+
+    std::size_t size() const { return position.size(); }
+
+    void resize(std::size_t n) {
+        position.resize(n);
+        direction.resize(n);
+    }
+
+    Ray operator[](std::size_t i) const { return Ray{position[i],direction[i]}; }
+
+    void Set(std::size_t i, const Ray& r) {
+        position.Set(i,r.position);
+        direction.Set(i,r.direction);
+    }
+
+    Vector3Array position;
+    Vector3Array direction;
+};
+
+//One group of FloatWidth rays, copied out of the packet so that the last group can be padded
+struct RayGroup {
+    alignas(64) float origin[3][Simd::FloatWidth];
+    alignas(64) float direction[3][Simd::FloatWidth];
+    alignas(64) float nearest[Simd::FloatWidth];  //Distance to the closest hit so far, infinity for none
+    std::size_t index[Simd::FloatWidth];
+};
+
+//Keeps t in each lane of closer as the group's nearest hit, on object j
+RAYLIBOPS_INLINE Simd::Floats KeepCloser(RayGroup& g, Simd::Floats t, unsigned int closer, std::size_t j) {
+    alignas(64) float lanes[Simd::FloatWidth];
+    Simd::Store(lanes,t);
+    for (int k=0; k<Simd::FloatWidth; k++) {
+        if ((closer>>k) & 1u) {
+            g.nearest[k]=lanes[k];
+            g.index[k]=j;
+        }
+    }
+return Simd::Load(g.nearest);
+}
+
+//The slab test for boxes.  inverse holds 1/direction per lane, except 0 in the lanes parallel[c] marks as parallel to axis c.  With Parallel, those lanes get slab bounds of
+//-inf and +inf from below and above, and pass only where CheckCollisionRayBox() lets them: when the ray starts strictly between the slab's planes, or on a flat slab's plane.
+template<bool Parallel> void CastBoxes(RayGroup& g, const BoundingBox* boxes, std::size_t n, const float (*inverse)[Simd::FloatWidth], const float (*below)[Simd::FloatWidth],
+                                       const float (*above)[Simd::FloatWidth], const unsigned int* parallel) {
+    const Simd::Floats zero=Simd::Splat(0.0f);
+    Simd::Floats o[3], ic[3], lower[3], upper[3];
+    for (int c=0; c<3; c++) {
+        o[c]=Simd::Load(g.origin[c]);
+        ic[c]=Simd::Load(inverse[c]);
+        lower[c]=Parallel?Simd::Load(below[c]):zero;
+        upper[c]=Parallel?Simd::Load(above[c]):zero;
+    }
+    Simd::Floats nearest=Simd::Load(g.nearest);
+    for (std::size_t j=0; j<n; j++) {
+        const float lo[3]={boxes[j].min.x,boxes[j].min.y,boxes[j].min.z}, hi[3]={boxes[j].max.x,boxes[j].max.y,boxes[j].max.z};
+        unsigned int inside=~0u;
+        auto slab=[&](int c, Simd::Floats& t1, Simd::Floats& t2) {
+            const Simd::Floats l=Simd::Splat(lo[c]), h=Simd::Splat(hi[c]);
+            t1=Simd::Multiply(Simd::Subtract(l,o[c]),ic[c]);
+            t2=Simd::Multiply(Simd::Subtract(h,o[c]),ic[c]);
+            if (Parallel) {
+                t1=Simd::Add(t1,lower[c]);
+                t2=Simd::Add(t2,upper[c]);
+                if (parallel[c]) {
+                    unsigned int within=(lo[c]==hi[c])?(Simd::LessEqualBits(o[c],l) & Simd::LessEqualBits(l,o[c])):(~Simd::LessEqualBits(o[c],l) & ~Simd::LessEqualBits(h,o[c]));
+                    inside&=within | ~parallel[c];
+                }
+            }
+        };
+        Simd::Floats t1, t2;
+        slab(0,t1,t2);
+        Simd::Floats entry=Simd::Min(t1,t2), exit=Simd::Max(t1,t2);
+        slab(1,t1,t2);
+        entry=Simd::Max(entry,Simd::Min(t1,t2));
+        exit=Simd::Min(exit,Simd::Max(t1,t2));
+        slab(2,t1,t2);
+        entry=Simd::Max(entry,Simd::Min(t1,t2));
+        exit=Simd::Min(exit,Simd::Max(t1,t2));
+        Simd::Floats t=Simd::Max(entry,zero);
+        unsigned int closer=Simd::LessEqualBits(t,exit) & ~Simd::LessEqualBits(nearest,t) & inside;
+        if (closer) nearest=KeepCloser(g,t,closer,j);
+    }
+}
+
+//A ray parallel to an axis (its direction 0 there, or so small that the reciprocal overflows) would take 0*inf=NaN for a slab whose plane it starts on, and the SIMD
+//Min and Max treat NaN differently on each backend.  Groups with such a lane take the slower path of CastBoxes<true>, which never forms NaN.
+RAYLIBOPS_INLINE void CastGroup(RayGroup& g, const BoundingBox* boxes, std::size_t n) {
+    const float infinity=std::numeric_limits<float>::infinity();
+    alignas(64) float inverse[3][Simd::FloatWidth], below[3][Simd::FloatWidth], above[3][Simd::FloatWidth];
+    unsigned int parallel[3]={0,0,0};
+    for (int c=0; c<3; c++) {
+        for (int k=0; k<Simd::FloatWidth; k++) {
+            float i=1.0f/g.direction[c][k];
+            bool along=std::isinf(i);
+            inverse[c][k]=along?0.0f:i;
+            below[c][k]=along?-infinity:0.0f;
+            above[c][k]=along?infinity:0.0f;
+            if (along) parallel[c]|=1u<<k;
+        }
+    }
+    if (parallel[0] | parallel[1] | parallel[2]) CastBoxes<true>(g,boxes,n,inverse,below,above,parallel);
+    else CastBoxes<false>(g,boxes,n,inverse,below,above,parallel);
+}
+
+RAYLIBOPS_INLINE void CastGroup(RayGroup& g, const Vector3* centers, const float* radii, std::size_t n) {
+    const Simd::Floats zero=Simd::Splat(0.0f), one=Simd::Splat(1.0f);
+    const Simd::Floats ox=Simd::Load(g.origin[0]), oy=Simd::Load(g.origin[1]), oz=Simd::Load(g.origin[2]);
+    const Simd::Floats dx=Simd::Load(g.direction[0]), dy=Simd::Load(g.direction[1]), dz=Simd::Load(g.direction[2]);
+    const Simd::Floats a=Simd::Add(Simd::Add(Simd::Multiply(dx,dx),Simd::Multiply(dy,dy)),Simd::Multiply(dz,dz)), inverseA=Simd::Divide(one,a);
+    Simd::Floats nearest=Simd::Load(g.nearest);
+    for (std::size_t j=0; j<n; j++) {
+        //With oc from the ray's start to the center, t=(b -+ sqrt(b*b-a*c))/a for b=dot(oc,d), c=dot(oc,oc)-r*r.  A miss takes the root of a negative: NaN fails every test below.
+        Simd::Floats cx=Simd::Subtract(Simd::Splat(centers[j].x),ox), cy=Simd::Subtract(Simd::Splat(centers[j].y),oy), cz=Simd::Subtract(Simd::Splat(centers[j].z),oz);
+        Simd::Floats b=Simd::Add(Simd::Add(Simd::Multiply(cx,dx),Simd::Multiply(cy,dy)),Simd::Multiply(cz,dz));
+        Simd::Floats c=Simd::Subtract(Simd::Add(Simd::Add(Simd::Multiply(cx,cx),Simd::Multiply(cy,cy)),Simd::Multiply(cz,cz)),Simd::Splat(radii[j]*radii[j]));
+        Simd::Floats root=Simd::Sqrt(Simd::Subtract(Simd::Multiply(b,b),Simd::Multiply(a,c)));
+        Simd::Floats exit=Simd::Multiply(Simd::Add(b,root),inverseA);
+        Simd::Floats t=Simd::Max(Simd::Multiply(Simd::Subtract(b,root),inverseA),zero);
+        unsigned int closer=Simd::LessEqualBits(t,exit) & ~Simd::LessEqualBits(nearest,t);
+        if (closer) nearest=KeepCloser(g,t,closer,j);
+    }
+}
+
+//Runs cast(group) for FloatWidth rays at a time, padding the last group with copies of the last ray, then fill(i,distance,index) for each ray in the group
+template<typename Cast, typename Fill> void CastRayGroups(const RayPacket& rays, std::size_t n, unsigned int threads, Cast cast, Fill fill) {
+    ParallelRanges(rays.size(),threads,[&rays,n,&cast,&fill](std::size_t begin, std::size_t end) {
+        RayGroup g;
+        for (std::size_t i=begin; i<end; i+=Simd::FloatWidth) {
+            for (int k=0; k<Simd::FloatWidth; k++) {
+                std::size_t from=std::min(i+k,end-1);
+                for (int c=0; c<3; c++) {
+                    g.origin[c][k]=rays.position.Lane(c)[from];
+                    g.direction[c][k]=rays.direction.Lane(c)[from];
+                }
+                g.nearest[k]=std::numeric_limits<float>::infinity();
+                g.index[k]=n;
+            }
+            cast(g);
+            for (int k=0; k<Simd::FloatWidth && i+k<end; k++) fill(i+k,g.nearest[k],g.index[k]);
+        }
+    },Simd::FloatWidth);
+}
+
+RAYLIBOPS_INLINE void CastRays(const RayPacket& rays, const BoundingBox* boxes, std::size_t n, RayHitInfo* hits, std::size_t* hitIndices=nullptr, unsigned int threads=1) {
+    CastRayGroups(rays,n,threads,[boxes,n](RayGroup& g) { CastGroup(g,boxes,n); }, [&rays,boxes,n,hits,hitIndices](std::size_t i, float t, std::size_t j) {
+        if (hitIndices) hitIndices[i]=j;
+        RayHitInfo h=RayHitInfo{};
+        if (j<n) {
+            Ray r=rays[i];
+            h.hit=true;
+            h.distance=t;
+            h.position=r*t;
+            if (t>0.0f) {  //The normal of the face the ray entered through: the slab whose entry was the last
+                const float o[3]={r.position.x,r.position.y,r.position.z}, d[3]={r.direction.x,r.direction.y,r.direction.z};
+                const float lo[3]={boxes[j].min.x,boxes[j].min.y,boxes[j].min.z}, hi[3]={boxes[j].max.x,boxes[j].max.y,boxes[j].max.z};
+                int axis=0;
+                float entry=-std::numeric_limits<float>::infinity();
+                for (int c=0; c<3; c++) {
+                    float inverse=1.0f/d[c];
+                    float enters=std::min((lo[c]-o[c])*inverse,(hi[c]-o[c])*inverse);
+                    if (enters>entry) {
+                        entry=enters;
+                        axis=c;
+                    }
+                }
+                float sign=(d[axis]>0.0f)?-1.0f:1.0f;
+                h.normal=Vector3{(axis==0)?sign:0.0f, (axis==1)?sign:0.0f, (axis==2)?sign:0.0f};
+            }
+        }
+        hits[i]=h;
+    });
+}
+
+RAYLIBOPS_INLINE void CastRays(const RayPacket& rays, const Vector3* centers, const float* radii, std::size_t n, RayHitInfo* hits, std::size_t* hitIndices=nullptr, unsigned int threads=1) {
+    CastRayGroups(rays,n,threads,[centers,radii,n](RayGroup& g) { CastGroup(g,centers,radii,n); }, [&rays,centers,radii,n,hits,hitIndices](std::size_t i, float t, std::size_t j) {
+        if (hitIndices) hitIndices[i]=j;
+        RayHitInfo h=RayHitInfo{};
+        if (j<n) {
+            h.hit=true;
+            h.distance=t;
+            h.position=rays[i]*t;
+            if (t>0.0f) {
+                float inverse=1.0f/radii[j];
+                h.normal=Vector3{(h.position.x-centers[j].x)*inverse, (h.position.y-centers[j].y)*inverse, (h.position.z-centers[j].z)*inverse};
+            }
+        }
+        hits[i]=h;
+    });
+}
+
+} // namespace RaylibOps
+
+// ********************************************
+//
+//           BATCHED COLOR OPERATIONS
+//
+// ********************************************
+//
+// ColorSpan applies the Color operators above to a whole run of pixels in place, e.g. an Image's data.  It does not own the pixels.
+// For example: RaylibOps::ColorSpan pixels(image); pixels*=0.5f; pixels+=overlay; pixels-=BLACK;
+// The right-hand side may be another span of the same length, a single Color applied to every pixel, or a float.  Results are identical to applying the Color operator pixel by pixel.
+// Saturating +, - and Color* run ByteWidth/4 pixels per instruction (8 with AVX2, 4 with SSE2 or NEON).  The float-based * and / convert 4 pixels at a time to floats and back.
+
+namespace RaylibOps {
+
+class ColorSpan {
+public:
+    ColorSpan(Color* pixels, std::size_t n) : data(pixels), count(n) {}
+
+    //Only base level (mipmap 0) pixels of an Image with PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 data can be viewed as Colors
+    explicit ColorSpan(Image& image) : data((Color*)image.data), count((std::size_t)image.width*image.height) {
+        if (image.format!=PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) {
+            std::fputs("ColorSpan requires PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 image data.\n",stderr);
+            throw std::invalid_argument("ColorSpan requires PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 image data");
+        }
+    }
+
+    Color* begin() const { return data; }
+    Color* end() const { return data+count; }
+    std::size_t size() const { return count; }
+    Color& operator[](std::size_t i) const { return data[i]; }
+
+private:
+    Color* data;
+    std::size_t count;
+};
+
+//The integer kernels.  Each Op supplies the scalar Color operator and the matching SIMD operation on Bytes.
+struct ColorAddOp {
+    static Color Apply(const Color& a, const Color& b) { return a+b; }
+#ifdef RAYLIBOPS_SIMD_BYTES
+    static Simd::Bytes Apply(Simd::Bytes a, Simd::Bytes b) { return Simd::AddSaturate(a,b); }
+#endif
+};
+
+struct ColorSubtractOp {
+    static Color Apply(const Color& a, const Color& b) { return a-b; }
+#ifdef RAYLIBOPS_SIMD_BYTES
+    static Simd::Bytes Apply(Simd::Bytes a, Simd::Bytes b) { return Simd::SubtractSaturate(a,b); }
+#endif
+};
+
+struct ColorMultiplyOp {
+    static Color Apply(const Color& a, const Color& b) { return a*b; }
+#ifdef RAYLIBOPS_SIMD_BYTES
+#ifndef COLOR_MODULATE_NORMALIZED
+    static Simd::Bytes Apply(Simd::Bytes a, Simd::Bytes b) { return Simd::MultiplySaturate(a,b); }
+#else
+    static Simd::Bytes Apply(Simd::Bytes a, Simd::Bytes b) { return Simd::MultiplyNormalized(a,b); }
+#endif
+#endif
+};
+
+//out[i]=a[i] op b[i].  out may be the same pointer as a or b.
+template<typename Op> void ColorsApply(const Color* a, const Color* b, Color* out, std::size_t n) {
+    std::size_t i=0;
+#ifdef RAYLIBOPS_SIMD_BYTES
+    const std::size_t step=Simd::ByteWidth/sizeof(Color);
+    for (; i+step<=n; i+=step) Simd::StoreBytes(out+i, Op::Apply(Simd::LoadBytes(a+i),Simd::LoadBytes(b+i)));
+#endif
+    for (; i<n; i++) out[i]=Op::Apply(a[i],b[i]);
+}
+
+//out[i]=a[i] op b
+template<typename Op> void ColorsApply(const Color* a, const Color& b, Color* out, std::size_t n) {
+    std::size_t i=0;
+#ifdef RAYLIBOPS_SIMD_BYTES
+    const std::size_t step=Simd::ByteWidth/sizeof(Color);
+    unsigned int word;
+    std::memcpy(&word,&b,sizeof(word));
+    Simd::Bytes vb=Simd::SplatWord(word);
+    for (; i+step<=n; i+=step) Simd::StoreBytes(out+i, Op::Apply(Simd::LoadBytes(a+i),vb));
+#endif
+    for (; i<n; i++) out[i]=Op::Apply(a[i],b);
+}
+
+//The float kernels, 4 pixels (16 channels) at a time.  Channels are converted to float, scaled or divided, clamped to 0..255 and truncated, exactly like ChannelClamp().
+#if defined(RAYLIBOPS_SIMD_AVX) || defined(RAYLIBOPS_SIMD_SSE)
+#define RAYLIBOPS_SIMD_CHANNELS
+struct ColorChannels {
+    __m128 f[4];
+
+    explicit ColorChannels(const Color* p) {
+        __m128i zero=_mm_setzero_si128(), bytes=_mm_loadu_si128((const __m128i*)p);
+        __m128i lo=_mm_unpacklo_epi8(bytes,zero), hi=_mm_unpackhi_epi8(bytes,zero);
+        f[0]=_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo,zero));
+        f[1]=_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo,zero));
+        f[2]=_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi,zero));
+        f[3]=_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi,zero));
+    }
+
+    void Store(Color* p) const {
+        __m128 zero=_mm_setzero_ps(), max=_mm_set1_ps(255.0f);
+        __m128i i[4];
+        for (int k=0; k<4; k++) i[k]=_mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(f[k],zero),max));  //max_ps returns zero for NaN
+        _mm_storeu_si128((__m128i*)p, _mm_packus_epi16(_mm_packs_epi32(i[0],i[1]),_mm_packs_epi32(i[2],i[3])));
+    }
+
+    void Multiply(float s) { __m128 v=_mm_set1_ps(s); for (int k=0; k<4; k++) f[k]=_mm_mul_ps(f[k],v); }
+    void Divide(float s) { __m128 v=_mm_set1_ps(s); for (int k=0; k<4; k++) f[k]=_mm_div_ps(f[k],v); }
+    void Divide(const ColorChannels& d) { for (int k=0; k<4; k++) f[k]=_mm_div_ps(f[k],d.f[k]); }
+};
+#elif defined(RAYLIBOPS_SIMD_NEON)
+#define RAYLIBOPS_SIMD_CHANNELS
+struct ColorChannels {
+    float32x4_t f[4];
+
+    explicit ColorChannels(const Color* p) {
+        uint8x16_t bytes=vld1q_u8((const uint8_t*)p);
+        uint16x8_t lo=vmovl_u8(vget_low_u8(bytes)), hi=vmovl_u8(vget_high_u8(bytes));
+        f[0]=vcvtq_f32_u32(vmovl_u16(vget_low_u16(lo)));
+        f[1]=vcvtq_f32_u32(vmovl_u16(vget_high_u16(lo)));
+        f[2]=vcvtq_f32_u32(vmovl_u16(vget_low_u16(hi)));
+        f[3]=vcvtq_f32_u32(vmovl_u16(vget_high_u16(hi)));
+    }
+
+    void Store(Color* p) const {
+        float32x4_t zero=vdupq_n_f32(0.0f), max=vdupq_n_f32(255.0f);
+        uint32x4_t i[4];
+        for (int k=0; k<4; k++) i[k]=vcvtq_u32_f32(vminq_f32(vmaxq_f32(f[k],zero),max));  //NaN converts to 0
+        uint16x8_t lo=vcombine_u16(vmovn_u32(i[0]),vmovn_u32(i[1])), hi=vcombine_u16(vmovn_u32(i[2]),vmovn_u32(i[3]));
+        vst1q_u8((uint8_t*)p, vcombine_u8(vmovn_u16(lo),vmovn_u16(hi)));
+    }
+
+    void Multiply(float s) { for (int k=0; k<4; k++) f[k]=vmulq_n_f32(f[k],s); }
+    void Divide(float s) { float32x4_t v=vdupq_n_f32(s); for (int k=0; k<4; k++) f[k]=vdivq_f32(f[k],v); }
+    void Divide(const ColorChannels& d) { for (int k=0; k<4; k++) f[k]=vdivq_f32(f[k],d.f[k]); }
+};
+#endif
+
+RAYLIBOPS_INLINE void ColorsScale(const Color* a, float b, Color* out, std::size_t n) {
+    std::size_t i=0;
+#ifdef RAYLIBOPS_SIMD_CHANNELS
+    for (; i+4<=n; i+=4) { ColorChannels c(a+i); c.Multiply(b); c.Store(out+i); }
+#endif
+    for (; i<n; i++) out[i]=a[i]*b;
+}
+
+RAYLIBOPS_INLINE void ColorsDivide(const Color* a, float b, Color* out, std::size_t n) {
+    std::size_t i=0;
+#ifdef RAYLIBOPS_SIMD_CHANNELS
+    for (; i+4<=n; i+=4) { ColorChannels c(a+i); c.Divide(b); c.Store(out+i); }
+#endif
+    for (; i<n; i++) out[i]=a[i]/b;
+}
+
+//Per channel integer quotient, computed through float: for channels of at most 255 the truncated float quotient is always the exact integer quotient.
+//With COLOR_MODULATE_NORMALIZED the scalar loop is used, since ChannelDivide() is then a table lookup and a multiply.
+RAYLIBOPS_INLINE void ColorsDivide(const Color* a, const Color* b, Color* out, std::size_t n) {
+    std::size_t i=0;
+#if defined(RAYLIBOPS_SIMD_CHANNELS) && !defined(COLOR_MODULATE_NORMALIZED)
+    for (; i+4<=n; i+=4) { ColorChannels c(a+i); c.Divide(ColorChannels(b+i)); c.Store(out+i); }
+#endif
+    for (; i<n; i++) out[i]=a[i]/b[i];
+}
+
+RAYLIBOPS_INLINE void ColorsDivide(const Color* a, const Color& b, Color* out, std::size_t n) {
+    std::size_t i=0;
+#if defined(RAYLIBOPS_SIMD_CHANNELS) && !defined(COLOR_MODULATE_NORMALIZED)
+    const Color repeated[4]={b,b,b,b};
+    ColorChannels d(repeated);
+    for (; i+4<=n; i+=4) { ColorChannels c(a+i); c.Divide(d); c.Store(out+i); }
+#endif
+    for (; i<n; i++) out[i]=a[i]/b;
+}
+
+RAYLIBOPS_INLINE void CheckSameSize(const ColorSpan& a, const ColorSpan& b) {
+    if (a.size()!=b.size()) {
+        std::fputs("Color span size mismatch.\n",stderr);
+        throw std::length_error("Color span size mismatch");
+    }
+}
+
+RAYLIBOPS_INLINE const ColorSpan& operator+=(const ColorSpan& a, const ColorSpan& b) {
+    CheckSameSize(a,b);
+    ColorsApply<ColorAddOp>(a.begin(),b.begin(),a.begin(),a.size());
+return a;
+}
+
+RAYLIBOPS_INLINE const ColorSpan& operator+=(const ColorSpan& a, const Color& b) {
+    ColorsApply<ColorAddOp>(a.begin(),b,a.begin(),a.size());
+return a;
+}
+
+RAYLIBOPS_INLINE const ColorSpan& operator-=(const ColorSpan& a, const ColorSpan& b) {
+    CheckSameSize(a,b);
+    ColorsApply<ColorSubtractOp>(a.begin(),b.begin(),a.begin(),a.size());
+return a;
+}
+
+RAYLIBOPS_INLINE const ColorSpan& operator-=(const ColorSpan& a, const Color& b) {
+    ColorsApply<ColorSubtractOp>(a.begin(),b,a.begin(),a.size());
+return a;
+}
+
+RAYLIBOPS_INLINE const ColorSpan& operator*=(const ColorSpan& a, const ColorSpan& b) {
+    CheckSameSize(a,b);
+    ColorsApply<ColorMultiplyOp>(a.begin(),b.begin(),a.begin(),a.size());
+return a;
+}
+
+RAYLIBOPS_INLINE const ColorSpan& operator*=(const ColorSpan& a, const Color& b) {
+    ColorsApply<ColorMultiplyOp>(a.begin(),b,a.begin(),a.size());
+return a;
+}
+
+RAYLIBOPS_INLINE const ColorSpan& operator*=(const ColorSpan& a, const float b) {
+    ColorsScale(a.begin(),b,a.begin(),a.size());
+return a;
+}
+
+RAYLIBOPS_INLINE const ColorSpan& operator/=(const ColorSpan& a, const ColorSpan& b) {
+    CheckSameSize(a,b);
+    ColorsDivide(a.begin(),b.begin(),a.begin(),a.size());
+return a;
+}
+
+RAYLIBOPS_INLINE const ColorSpan& operator/=(const ColorSpan& a, const Color& b) {
+    ColorsDivide(a.begin(),b,a.begin(),a.size());
+return a;
+}
+
+RAYLIBOPS_INLINE const ColorSpan& operator/=(const ColorSpan& a, const float b) {
+    ColorsDivide(a.begin(),b,a.begin(),a.size());
+return a;
+}
+
+} // namespace RaylibOps
+
+// ********************************************
+//
+//           LINEAR COLOR
+//
+// ********************************************
+// Color channels are sRGB encoded, so adding or scaling them is not physically meaningful: 50% grey plus 50% grey should not be white.  RaylibOps::LinearColor holds
+// four floats in linear light, 0 to 1, where +, -, * (per channel, or by a float) and the compound forms mean what lighting and blending need.  Nothing is clamped, so
+// HDR values above 1 are kept until the conversion back to Color.  Alpha is never gamma encoded: it is just divided by 255 and multiplied back.
+//
+// LinearColor(color) decodes through a 256-entry table and Color(linear) encodes through a bucket table and one comparison, which rounds to the nearest 8-bit sRGB
+// value without a pow() call.  Both tables are computed at compile time.  ToLinear(colors,out,n) and ToSrgb(linear,out,n) convert whole spans, e.g. an Image's pixels,
+// and like TransformPoints take an optional thread count.  A Color survives the round trip to LinearColor and back unchanged.  Going back, each channel is clamped:
+// 0 and below, and NaN, become 0, and 1 and above become 255.
+namespace RaylibOps {
+
+//x^0.2 for 0<x<=1, by Newton's method, which converges from above for any start above the root
+constexpr double FifthRoot(double x) {
+    double y=1.0;
+    for (int i=0; i<60; i++) y=(4.0*y + x/(y*y*y*y))/5.0;
+return y;
+}
+
+//sRGB transfer function, encoded 0..1 to linear 0..1, as IEC 61966-2-1 defines it
+constexpr double SrgbDecode(double c) {
+    if (c<=0.04045) return c/12.92;
+    double x=(c+0.055)/1.055;
+return x*x*FifthRoot(x*x);  //x^2.4 is x^2 times (x^2)^0.2
+}
+
+//Linear to sRGB encoding goes through buckets of the float's bit pattern: 128 per power of two from 2^-13 (below which everything encodes to 0) to 1.
+//No bucket contains more than one rounding threshold, so the code at the start of a bucket and one comparison give the rounded result.
+const int SrgbBucketCount=13*128;
+
+struct SrgbTables {
+    float toLinear[256];  //Linear value of each 8-bit code
+    double thresholds[257];  //thresholds[k]: the linear value from which on values encode to k or more.  thresholds[256] is past every value.  In double, so floats just either side round correctly.
+    unsigned char buckets[SrgbBucketCount];  //The code at the start of each bucket
+};
+
+constexpr SrgbTables MakeSrgbTables() {
+    SrgbTables t{};
+    for (int k=0; k<256; k++) t.toLinear[k]=(float)SrgbDecode(k/255.0);
+    t.thresholds[0]=0.0;
+    for (int k=1; k<256; k++) t.thresholds[k]=SrgbDecode((k-0.5)/255.0);
+    t.thresholds[256]=2.0;
+    for (int i=0; i<SrgbBucketCount; i++) {
+        double start=1.0;
+        for (int e=i/128; e<13; e++) start/=2.0;
+        start*=1.0+(i%128)/128.0;
+        int k=0;
+        while (k<255 && t.thresholds[k+1]<=start) k++;
+        t.buckets[i]=(unsigned char)k;
+    }
+return t;
+}
+
+inline constexpr SrgbTables SrgbLookup=MakeSrgbTables();
+
+RAYLIBOPS_INLINE float SrgbToLinear(unsigned char c) {
+return SrgbLookup.toLinear[c];
+}
+
+RAYLIBOPS_INLINE unsigned char LinearToSrgb(float x) {
+    const float lowest=1.0f/8192.0f;  //2^-13, the start of the first bucket
+    const float highest=0.99999994f;  //The largest float below 1
+    if (!(x>lowest)) x=lowest;  //Also maps NaN to 0
+    if (x>highest) x=highest;
+    std::uint32_t bits;
+    std::memcpy(&bits,&x,sizeof(bits));
+    unsigned int k=SrgbLookup.buckets[(bits-0x39000000u)>>16];  //0x39000000 is the bit pattern of 2^-13; the exponent and 7 mantissa bits pick the bucket
+return (unsigned char)(k + ((double)x>=SrgbLookup.thresholds[k+1]));
+}
+
+//Alpha: the nearest of the 256 levels
+RAYLIBOPS_INLINE unsigned char LinearToAlpha(float a) {
+    float scaled=a*255.0f+0.5f;
+    if (!(scaled>0.0f)) return 0;
+return (scaled>=255.0f)?255:(unsigned char)scaled;
+}
+
+struct LinearColor {
+    float r, g, b, a;
+
+    constexpr LinearColor() : r(0.0f), g(0.0f), b(0.0f), a(0.0f) {}
+    constexpr LinearColor(float r, float g, float b, float a=1.0f) : r(r), g(g), b(b), a(a) {}
+
+    explicit LinearColor(const Color& c) : r(SrgbToLinear(c.r)), g(SrgbToLinear(c.g)), b(SrgbToLinear(c.b)), a(c.a/255.0f) {}
+
+    //Rounds to the nearest sRGB code, clamping to 0..255
+    explicit operator Color() const { return Color{LinearToSrgb(r), LinearToSrgb(g), LinearToSrgb(b), LinearToAlpha(a)}; }
+};
+
+RAYLIBOPS_CONSTEXPR LinearColor operator+(const LinearColor& x, const LinearColor& y) {
+return LinearColor(x.r+y.r, x.g+y.g, x.b+y.b, x.a+y.a);
+}
+
+RAYLIBOPS_CONSTEXPR LinearColor operator-(const LinearColor& x, const LinearColor& y) {
+return LinearColor(x.r-y.r, x.g-y.g, x.b-y.b, x.a-y.a);
+}
+
+//Per channel, e.g. light color times surface albedo
+RAYLIBOPS_CONSTEXPR LinearColor operator*(const LinearColor& x, const LinearColor& y) {
+return LinearColor(x.r*y.r, x.g*y.g, x.b*y.b, x.a*y.a);
+}
+
+RAYLIBOPS_CONSTEXPR LinearColor operator*(const LinearColor& x, float s) {
+return LinearColor(x.r*s, x.g*s, x.b*s, x.a*s);
+}
+
+RAYLIBOPS_CONSTEXPR LinearColor operator*(float s, const LinearColor& x) {
+return x*s;
+}
+
+RAYLIBOPS_CONSTEXPR LinearColor& operator+=(LinearColor& x, const LinearColor& y) {
+    x=x+y;
+return x;
+}
+
+RAYLIBOPS_CONSTEXPR LinearColor& operator-=(LinearColor& x, const LinearColor& y) {
+    x=x-y;
+return x;
+}
+
+RAYLIBOPS_CONSTEXPR LinearColor& operator*=(LinearColor& x, const LinearColor& y) {
+    x=x*y;
+return x;
+}
+
+RAYLIBOPS_CONSTEXPR LinearColor& operator*=(LinearColor& x, float s) {
+    x=x*s;
+return x;
+}
+
+RAYLIBOPS_INLINE void ToLinear(const Color* in, LinearColor* out, std::size_t n, unsigned int threads=1) {
+    ParallelRanges(n,threads,[in,out](std::size_t begin, std::size_t end) {
+        for (std::size_t i=begin; i<end; i++) out[i]=LinearColor(in[i]);
+    });
+}
+
+RAYLIBOPS_INLINE void ToSrgb(const LinearColor* in, Color* out, std::size_t n, unsigned int threads=1) {
+    ParallelRanges(n,threads,[in,out](std::size_t begin, std::size_t end) {
+        for (std::size_t i=begin; i<end; i++) out[i]=(Color)in[i];
+    });
+}
+
+} // namespace RaylibOps
+
+// ********************************************
+//
+//           SPATIAL HASHING
+//
+// ********************************************
+//
+// Hash functors for Color, Vector2, Vector3 and Vector4, and a hash grid for finding equal vectors among many, e.g. to weld the vertices of a mesh.
+//
+// ExactHash hashes the exact component values (with -0 treated as +0) and ExactEqual compares them with ==, so together they key a std::unordered_map or
+// std::unordered_set on exact vectors whatever the EQUALITY_OPERATOR_ option: std::unordered_set<Vector3,RaylibOps::ExactHash,RaylibOps::ExactEqual>.
+// std::hash<Color> is always defined, since Colors compare exactly.  std::hash<Vector2>, <Vector3> and <Vector4> are defined only with EQUALITY_OPERATOR_SIMPLE,
+// because no hash can be consistent with a tolerance: two vectors which are equal under EQUALITY_OPERATOR_KNUTH may differ in their last bit and so hash differently.
+// To find vectors equal within a tolerance, use HashGrid, which quantizes positions into cells and also probes the neighboring cells an equal vector could fall into.
+#include <functional>
+#include <algorithm>
+
+namespace RaylibOps {
+
+RAYLIBOPS_INLINE std::size_t HashFloat(float f) {
+    std::uint32_t bits;
+    f=(f==0.0f)?0.0f:f;  //-0==+0, so they must hash alike
+    std::memcpy(&bits,&f,sizeof(bits));
+return bits;
+}
+
+RAYLIBOPS_INLINE std::size_t HashCombine(std::size_t seed, std::size_t value) {
+return seed ^ (value+(std::size_t)0x9e3779b97f4a7c15ull+(seed<<6)+(seed>>2));
+}
+
+struct ExactHash {
+    std::size_t operator()(const Color& c) const {
+    return (std::size_t)c.r | ((std::size_t)c.g<<8) | ((std::size_t)c.b<<16) | ((std::size_t)c.a<<24);
+    }
+    std::size_t operator()(const Vector2& v) const {
+    return HashCombine(HashFloat(v.x),HashFloat(v.y));
+    }
+    std::size_t operator()(const Vector3& v) const {
+    return HashCombine(HashCombine(HashFloat(v.x),HashFloat(v.y)),HashFloat(v.z));
+    }
+    std::size_t operator()(const Vector4& v) const {
+    return HashCombine(HashCombine(HashCombine(HashFloat(v.x),HashFloat(v.y)),HashFloat(v.z)),HashFloat(v.w));
+    }
+};
+
+struct ExactEqual {
+    bool operator()(const Color& a, const Color& b) const { return (a.r==b.r) & (a.g==b.g) & (a.b==b.b) & (a.a==b.a); }
+    template<typename V> FloatVector<V,bool> operator()(const V& a, const V& b) const { return ApproximatelyEqual<ExactTolerance>(a,b); }
+};
+
+// HashGrid<V,Tolerance> stores Vector2s or Vector3s and finds, for a query vector, the stored vector nearest to it among those which ApproximatelyEqual<Tolerance>() it.
+// Each vector lives in the cell floor(v/cellSize).  A query looks in its own cell and in any neighbor within Tolerance::Reach() of it, usually just one cell, so
+// welding n vertices takes roughly linear time instead of comparing every pair.  The tolerance defaults to the EQUALITY_OPERATOR_ choice in RaylibOpsConfig.hpp.
+// An infinite or NaN component only looks in its own cell, and a query whose neighborhood spans more cells than there are stored vectors checks the vectors instead.
+//
+// Cells are kept in a flat, power-of-two sized bucket table with the vectors of each bucket chained through an index array, so inserting never allocates per vector.
+// The cell size should be around the typical spacing between distinct vectors.  Build() and Weld() choose one from the bounding box if none was given.
+template<typename V, typename Tolerance=DefaultTolerance> class HashGrid {
+public:
+    static const int Dimension=VectorLayout<V>::Dimension;
+    static constexpr std::size_t npos=(std::size_t)-1;
+
+    explicit HashGrid(float cellSize=0.0f) { SetCellSize(cellSize); }
+
+    float CellSize() const { return cell; }
+    std::size_t size() const { return points.size(); }
+    const V& operator[](std::size_t i) const { return points[i]; }
+    const std::vector<V>& Points() const { return points; }
+
+    void clear() {
+        points.clear();
+        next.clear();
+        std::fill(heads.begin(),heads.end(),Empty);
+    }
+
+    //Adds v, even if an equal vector is already stored, and returns its index
+    std::size_t Insert(const V& v) {
+        if (cell<=0.0f) {
+            std::fputs("HashGrid cell size must be positive.\n",stderr);
+            throw std::invalid_argument("HashGrid cell size must be positive");
+        }
+        if (points.size()>=heads.size()) Rehash(2*points.size()+16);
+        std::size_t i=points.size();
+        Cell c[Dimension];
+        CellsOf(v,c);
+        std::size_t b=BucketOf(c);
+        points.push_back(v);
+        next.push_back(heads[b]);
+        heads[b]=(std::uint32_t)i;
+    return i;
+    }
+
+    //Replaces the contents with n vectors in one pass, choosing a cell size first if none was set
+    void Build(const V* v, std::size_t n) {
+        clear();
+        if (cell<=0.0f) SetCellSize(SuggestCellSize(v,n));
+        Rehash(2*n);
+        points.reserve(n);
+        next.reserve(n);
+        for (std::size_t i=0; i<n; i++) Insert(v[i]);
+    }
+
+    //Index of the stored vector nearest to v among those equal to it, or npos if there is none
+    std::size_t FindEqual(const V& v) const {
+        std::size_t best=npos;
+        if (points.empty()) return best;
+        float bestDistance=0.0f;
+        Cell lo[Dimension], hi[Dimension], c[Dimension];
+        std::size_t cells=1;
+        for (int k=0; k<Dimension; k++) {
+            float f=VectorLayout<V>::Get(v,k), r=Tolerance::Reach(f);
+            if (std::isfinite(f) && std::isfinite(r)) {
+                lo[k]=CellOf(f-r);
+                hi[k]=CellOf(f+r);
+            }
+            else lo[k]=hi[k]=CellOf(f);  //NaN equals nothing, and an infinity can only equal vectors clamped into its own, outermost cell
+            c[k]=lo[k];
+            std::uint64_t span=(std::uint64_t)(hi[k]-lo[k])+1;
+            cells=(span>points.size() || cells*span>points.size())?points.size()+1:cells*(std::size_t)span;
+        }
+        if (cells>points.size()) {  //A box of more cells than vectors, e.g. from a large relative tolerance, costs less to check vector by vector
+            for (std::size_t i=0; i<points.size(); i++) Consider(i,v,best,bestDistance);
+        return best;
+        }
+        for (;;) {  //Visit every cell in the box lo..hi
+            for (std::uint32_t i=heads[BucketOf(c)]; i!=Empty; i=next[i]) Consider(i,v,best,bestDistance);
+            int k=0;
+            for (; k<Dimension && c[k]==hi[k]; k++) c[k]=lo[k];
+            if (k==Dimension) break;
+            c[k]++;
+        }
+    return best;
+    }
+
+    //Returns the index of a stored vector equal to v, inserting v first if there is none
+    std::size_t InsertUnique(const V& v) {
+        std::size_t i=FindEqual(v);
+    return (i!=npos)?i:Insert(v);
+    }
+
+    //A cell size giving about one vector per cell, from the bounding box of the vectors (ignoring flat dimensions)
+    static float SuggestCellSize(const V* v, std::size_t n) {
+        if (n==0) return 1.0f;
+        float lo[Dimension], hi[Dimension];
+        for (int k=0; k<Dimension; k++) lo[k]=hi[k]=VectorLayout<V>::Get(v[0],k);
+        for (std::size_t i=1; i<n; i++) {
+            for (int k=0; k<Dimension; k++) {
+                float f=VectorLayout<V>::Get(v[i],k);
+                lo[k]=std::min(lo[k],f);
+                hi[k]=std::max(hi[k],f);
+            }
+        }
+        double volume=1.0;
+        int dimensions=0;
+        for (int k=0; k<Dimension; k++) {
+            if (hi[k]>lo[k]) { volume*=(double)hi[k]-lo[k]; dimensions++; }
+        }
+        if (dimensions==0 || !std::isfinite(volume)) return 1.0f;
+    return (float)std::pow(volume/n,1.0/dimensions);
+    }
+
+private:
+    typedef std::int64_t Cell;
+    static constexpr std::uint32_t Empty=0xffffffffu;
+
+    void SetCellSize(float size) {
+        cell=size;
+        inverse=(size>0.0f)?1.0f/size:0.0f;
+    }
+
+    Cell CellOf(float f) const {
+        if (std::isinf(f) && Tolerance::Equal(f,-f)) f=std::fabs(f);  //|inf-(-inf)| <= inf, so under a relative tolerance both infinities share a cell
+        float q=std::floor(f*inverse);
+        q=(q==q)?q:0.0f;  //NaN, which equals nothing, goes anywhere.  Huge values are clamped so the cast is defined.
+    return (Cell)std::max(std::min(q,4.0e18f),-4.0e18f);
+    }
+
+    void CellsOf(const V& v, Cell* out) const {
+        for (int k=0; k<Dimension; k++) out[k]=CellOf(VectorLayout<V>::Get(v,k));
+    }
+
+    std::size_t BucketOf(const Cell* c) const {
+        std::uint64_t h=0;
+        for (int k=0; k<Dimension; k++) {  //splitmix64 finalizer on each coordinate
+            h^=(std::uint64_t)c[k]+0x9e3779b97f4a7c15ull+(h<<6)+(h>>2);
+            h=(h^(h>>30))*0xbf58476d1ce4e5b9ull;
+            h=(h^(h>>27))*0x94d049bb133111ebull;
+            h^=h>>31;
+        }
+    return (std::size_t)h & (heads.size()-1);
+    }
+
+    void Rehash(std::size_t count) {
+        std::size_t n=16;
+        while (n<count) n*=2;
+        if (n<=heads.size()) return;
+        heads.assign(n,Empty);
+        Cell c[Dimension];
+        for (std::size_t i=0; i<points.size(); i++) {
+            CellsOf(points[i],c);
+            std::size_t b=BucketOf(c);
+            next[i]=heads[b];
+            heads[b]=(std::uint32_t)i;
+        }
+    }
+
+    //Makes points[i] the best match so far if it equals v and is nearer than the previous best
+    void Consider(std::size_t i, const V& v, std::size_t& best, float& bestDistance) const {
+        if (!ApproximatelyEqual<Tolerance>(points[i],v)) return;
+        float d=DistanceSquared(points[i],v);
+        if (best==npos || d<bestDistance) { best=i; bestDistance=d; }
+    }
+
+    static float DistanceSquared(const V& a, const V& b) {
+        float d=0.0f;
+        for (int k=0; k<Dimension; k++) {
+            float x=VectorLayout<V>::Get(a,k), y=VectorLayout<V>::Get(b,k);
+            float e=(x==y)?0.0f:x-y;  //Equal infinities are no distance apart, not NaN
+            d+=e*e;
+        }
+    return d;
+    }
+
+    float cell, inverse;
+    std::vector<V> points;
+    std::vector<std::uint32_t> next;
+    std::vector<std::uint32_t> heads;
+};
+
+//Welds n vectors: returns the distinct ones (under Tolerance) in order of first appearance, and sets remap[i] to the index in that list of the vector v[i] became
+template<typename Tolerance=DefaultTolerance, typename V> std::vector<V> Weld(const V* v, std::size_t n, std::vector<std::size_t>& remap) {
+    HashGrid<V,Tolerance> grid(HashGrid<V,Tolerance>::SuggestCellSize(v,n));
+    remap.resize(n);
+    for (std::size_t i=0; i<n; i++) remap[i]=grid.InsertUnique(v[i]);
+return grid.Points();
+}
+
+} // namespace RaylibOps
+
+namespace std {
+
+template<> struct hash<Color> : RaylibOps::ExactHash {};
+
+//Consistent with operator== only when it is exact
+#ifdef EQUALITY_OPERATOR_SIMPLE
+template<> struct hash<Vector2> : RaylibOps::ExactHash {};
+template<> struct hash<Vector3> : RaylibOps::ExactHash {};
+template<> struct hash<Vector4> : RaylibOps::ExactHash {};
+#endif
+
+} // namespace std
+
+// ********************************************
+//
+//           IMAGE OPERATIONS
+//
+// ********************************************
+// The Color operators applied to every pixel of an Image, in place on its pixel buffer: image+=overlay; image-=background; image*=tint; image*=exposure;
+// Each overload checks the pixel format (see PixelFormatNumberToName() in RaylibOpsPixelFormat.hpp) and picks a kernel for it:
+//   8 bit channel formats (GRAYSCALE, GRAY_ALPHA, R8G8B8, R8G8B8A8) use the saturating SIMD Color kernels of ColorSpan, and give exactly what the Color operators give channel by channel.
+//   32 bit float formats (R32, R32G32B32, R32G32B32A32) add, subtract and scale the floats unclamped, like the Vector operators.
+//   Packed 16 bit and compressed formats throw std::domain_error: convert them with ImageFormat() first.
+// Both images of +=, -= and RaylibOps::DifferenceImage() must match in width, height, format and mipmaps, or they throw std::domain_error.  Every mipmap level is processed.
+// The pixel buffer is split into contiguous runs spread across the ThreadPool, always whole pixels.  Since each byte is visited exactly once, walking the buffer in order
+// is already the cache friendly order; two-dimensional tiles would only help operations that read neighboring rows.
+// The named functions take a thread count (0, the default, for all the pool has); the operators always use the whole pool.  Images of fewer than 2*ParallelMinimum channels run on the calling thread.
+
+namespace RaylibOps {
+
+//Every image kernel piece starts on a multiple of this many channels: divisible by 1, 2, 3 and 4 channels and by the SIMD widths
+const std::size_t ImageGranule=192;
+
+enum class ImageChannels { Bytes, Floats };
+
+//Which kernel family handles an image's format.  Throws for formats whose channels are not whole bytes or floats.
+RAYLIBOPS_INLINE ImageChannels ImageChannelLayout(const Image& image) {
+    const PixelFormatInfo& f=PixelFormatLookup(image.format);
+    if (f.format!=0 && !f.compressed) {
+        if (f.bitsPerPixel==8*f.channels) return ImageChannels::Bytes;
+        if (f.bitsPerPixel==32*f.channels) return ImageChannels::Floats;
+    }
+    std::fprintf(stderr,"Image operations do not support %s.\n",f.name);
+    throw std::domain_error("Image operations require 8 bit or 32 bit float channels");
+}
+
+RAYLIBOPS_INLINE void CheckSameImage(const Image& a, const Image& b) {
+    if (a.width!=b.width || a.height!=b.height || a.format!=b.format || a.mipmaps!=b.mipmaps) {
+        std::fputs("Image size or format mismatch.\n",stderr);
+        throw std::domain_error("Image size or format mismatch");
+    }
+}
+
+//|a-b| per channel: one of the two saturating differences is always zero
+struct ColorDifferenceOp {
+    static Color Apply(const Color& a, const Color& b) { return (a-b)+(b-a); }
+#ifdef RAYLIBOPS_SIMD_BYTES
+    static Simd::Bytes Apply(Simd::Bytes a, Simd::Bytes b) { return Simd::AddSaturate(Simd::SubtractSaturate(a,b),Simd::SubtractSaturate(b,a)); }
+#endif
+};
+
+//The byte kernels view n channels as n/4 Colors, whatever the channel count, since these operations treat every channel alike
+template<typename Op> void ChannelsApply(unsigned char* a, const unsigned char* b, std::size_t n) {
+    std::size_t whole=n/sizeof(Color);
+    ColorsApply<Op>((const Color*)a,(const Color*)b,(Color*)a,whole);
+    for (std::size_t i=whole*sizeof(Color); i<n; i++) a[i]=Op::Apply(Color{a[i],0,0,0},Color{b[i],0,0,0}).r;
+}
+
+RAYLIBOPS_INLINE void ChannelsScale(unsigned char* a, float s, std::size_t n) {
+    std::size_t whole=n/sizeof(Color);
+    ColorsScale((const Color*)a,s,(Color*)a,whole);
+    for (std::size_t i=whole*sizeof(Color); i<n; i++) a[i]=ChannelClamp((float)a[i]*s);
+}
+
+RAYLIBOPS_INLINE void LanesDifference(const float* a, const float* b, float* out, std::size_t n) {
+    std::size_t i=0;
+    for (; i+Simd::FloatWidth<=n; i+=Simd::FloatWidth) Simd::Store(out+i, Simd::Abs(Simd::Subtract(Simd::Load(a+i),Simd::Load(b+i))));
+    for (; i<n; i++) out[i]=std::fabs(a[i]-b[i]);
+}
+
+//a op= b over the whole pixel buffer: ByteOp for 8 bit channels, lanes for float channels
+template<typename ByteOp> void ImageApply(Image& a, const Image& b, unsigned int threads, void (*lanes)(const float*, const float*, float*, std::size_t)) {
+    CheckSameImage(a,b);
+    std::size_t bytes=ImageDataSize(a);
+    if (ImageChannelLayout(a)==ImageChannels::Bytes) {
+        unsigned char* pa=(unsigned char*)a.data;
+        const unsigned char* pb=(const unsigned char*)b.data;
+        ParallelRanges(bytes,threads,[pa,pb](std::size_t begin, std::size_t end) { ChannelsApply<ByteOp>(pa+begin,pb+begin,end-begin); },ImageGranule);
+    }
+    else {
+        float* pa=(float*)a.data;
+        const float* pb=(const float*)b.data;
+        ParallelRanges(bytes/sizeof(float),threads,[pa,pb,lanes](std::size_t begin, std::size_t end) { lanes(pa+begin,pb+begin,pa+begin,end-begin); },ImageGranule);
+    }
+}
+
+//Saturating a+b per channel, like Color+Color
+RAYLIBOPS_INLINE Image& AddImage(Image& a, const Image& b, unsigned int threads=0) {
+    ImageApply<ColorAddOp>(a,b,threads,LanesAdd);
+return a;
+}
+
+//Saturating a-b per channel, like Color-Color
+RAYLIBOPS_INLINE Image& SubtractImage(Image& a, const Image& b, unsigned int threads=0) {
+    ImageApply<ColorSubtractOp>(a,b,threads,LanesSubtract);
+return a;
+}
+
+//|a-b| per channel, for comparing two renders or frames.  Identical images give all zeros.
+RAYLIBOPS_INLINE Image& DifferenceImage(Image& a, const Image& b, unsigned int threads=0) {
+    ImageApply<ColorDifferenceOp>(a,b,threads,LanesDifference);
+return a;
+}
+
+//Every color channel times s, clamped to 0..255 for 8 bit channels like Color*float.  Alpha channels are scaled too.
+RAYLIBOPS_INLINE Image& ScaleImage(Image& a, float s, unsigned int threads=0) {
+    std::size_t bytes=ImageDataSize(a);
+    if (ImageChannelLayout(a)==ImageChannels::Bytes) {
+        unsigned char* p=(unsigned char*)a.data;
+        ParallelRanges(bytes,threads,[p,s](std::size_t begin, std::size_t end) { ChannelsScale(p+begin,s,end-begin); },ImageGranule);
+    }
+    else {
+        float* p=(float*)a.data;
+        ParallelRanges(bytes/sizeof(float),threads,[p,s](std::size_t begin, std::size_t end) { LanesScale(p+begin,s,p+begin,end-begin); },ImageGranule);
+    }
+return a;
+}
+
+//Every pixel times tint, like Color*Color.  R8G8B8 pixels ignore tint.a.  Float pixels are multiplied by tint/255, so WHITE leaves them unchanged.
+//Needs 3 or 4 channels: grayscale formats throw std::domain_error.
+RAYLIBOPS_INLINE Image& TintImage(Image& a, const Color& tint, unsigned int threads=0) {
+    ImageChannels layout=ImageChannelLayout(a);
+    const PixelFormatInfo& f=PixelFormatLookup(a.format);
+    if (f.channels<3) {
+        std::fprintf(stderr,"Tinting requires a color image, not %s.\n",f.name);
+        throw std::domain_error("Tinting requires a color image");
+    }
+    std::size_t bytes=ImageDataSize(a);
+    if (layout==ImageChannels::Bytes && f.channels==4) {
+        Color* p=(Color*)a.data;
+        ParallelRanges(bytes/sizeof(Color),threads,[p,&tint](std::size_t begin, std::size_t end) { ColorsApply<ColorMultiplyOp>(p+begin,tint,p+begin,end-begin); },ImageGranule);
+    }
+    else if (layout==ImageChannels::Bytes) {
+        unsigned char* p=(unsigned char*)a.data;
+        ParallelRanges(bytes,threads,[p,&tint](std::size_t begin, std::size_t end) {
+            for (std::size_t i=begin; i<end; i+=3) {
+                p[i]=ChannelMultiply(p[i],tint.r);
+                p[i+1]=ChannelMultiply(p[i+1],tint.g);
+                p[i+2]=ChannelMultiply(p[i+2],tint.b);
+            }
+        },ImageGranule);
+    }
+    else {
+        float* p=(float*)a.data;
+        const float scale[4]={tint.r/255.0f,tint.g/255.0f,tint.b/255.0f,tint.a/255.0f};
+        const int channels=f.channels;
+        ParallelRanges(bytes/sizeof(float),threads,[p,&scale,channels](std::size_t begin, std::size_t end) {
+            for (std::size_t i=begin; i<end; i+=channels) {
+                for (int k=0; k<channels; k++) p[i+k]*=scale[k];
+            }
+        },ImageGranule);
+    }
+return a;
+}
+
+} // namespace RaylibOps
+
+RAYLIBOPS_INLINE Image& operator+=(Image& a, const Image& b) {
+return RaylibOps::AddImage(a,b);
+}
+
+RAYLIBOPS_INLINE Image& operator-=(Image& a, const Image& b) {
+return RaylibOps::SubtractImage(a,b);
+}
+
+RAYLIBOPS_INLINE Image& operator*=(Image& a, const Color& b) {
+return RaylibOps::TintImage(a,b);
+}
+
+RAYLIBOPS_INLINE Image& operator*=(Image& a, const float b) {
+return RaylibOps::ScaleImage(a,b);
+}
+
+#endif // RAYLIBOPS_BATCHED_HPP_INCLUDED
+
+//Printing a CameraSnapshot needs this part and the output one, so whichever of the two comes second defines it
+#ifdef RAYLIBOPS_OUTPUT_HPP_INCLUDED
+#include "RaylibOpsOutput.hpp"
+#endif
@@ -0,0 +1,367 @@
+#ifndef RAYLIBOPS_CONFIG_HPP_INCLUDED
+#define RAYLIBOPS_CONFIG_HPP_INCLUDED
+#include "raylib.h"
+#include "raymath.h"
+#include <cstdio> //For the error messages written to stderr before throwing
+
+// **************************************************************
+//
+//      C++ Operator Overloads for RayLib: options
+//
+// **************************************************************
+//
+// The options below apply to every part of the library, since each part includes this file.  See RaylibOpOverloads.hpp for the list of parts.
+// --------------------------------------------------------------
+//
+//  SELECT YOUR OPTIONS USING THE DEFINE STATEMENTS BELOW
+//
+// (A) Vector format
+//
+// PRINT_VECTORS_WITH_PARENTHESES prints a vector like an ordered set.  Vector3 {1,2,3} prints as (1,2,3).  Colors print as (255,255,255,255) in RGBA order.
+// PRINT_VECTORS_BY_COMPONENT prints a Vector3 {1,2,3} like so: x=1, y=2, z=3.  Colors like so: R=255, G=255, B=255, A=255
+//
+// (B) Equality Operator
+//
+// Operator== determines whether Vector A equals Vector B.  The evaluation is straightforward with integer types, but not with floats.
+// Three options are provided for the floating point types Vector2 and Vector3
+//
+// EQUALITY_OPERATOR_SIMPLE: Evaluates VectorA==VectorB as true IFF a.x==b.x and a.y==b.y, etc.  The overload merely invokes how operator== is defined for floats in one's C++ implementation.
+// EQUALITY_OPERATOR_KNUTH: Uses C++ machine epsilon from std::numeric_limits to establish inequality if two quantities are close enough to be considered equal given the machine's precision and the magnitude of the floats.  From https://stackoverflow.com/a/253874, which in turn cites Knuth
+// NONE: Comment out both options and the equality operator will not be overloaded at all.  Attempts to evaluate VectorA==VectorB will not compile.
+//
+// To see the difference between _SIMPLE and _KNUTH, try this test: Vector3 v1={1.0,1.5,2.0}; v2=v1; v2*=sqrt(2.0); v2/=sqrt(2.0); Does v1==v2 ?  With _SIMPLE no; with _KNUTH, yes.
+//
+// (C) Expression templates
+//
+// VECTOR_EXPRESSION_TEMPLATES: When defined, operator+, operator- and scalar operator* for Vector2 and Vector3 no longer return a new vector from each RayLib call.
+// Instead they build a lightweight expression which is evaluated component by component, in a single pass, only when it is assigned to a Vector2 or Vector3.
+// So VectorA=2.0*VectorB-(VectorC+VectorD) compiles to one loop-free statement per component instead of three RayLib calls.  The results are the same as without the option.
+// Caveat: an unevaluated expression holds references to its operands, so don't store one with auto (e.g. auto v=a+b;).  Write Vector3 v=a+b; instead.
+//
+// (D) SIMD
+//
+// The batched operations (e.g. Vector3Array) pick AVX, SSE2 or NEON kernels at compile time according to the flags given to your compiler (e.g. -mavx2).
+// DISABLE_SIMD: Forces the plain scalar loops everywhere.  Handy for debugging, or to compare results and speed.
+//
+// (E) Color multiplication and division
+//
+// By default Color*Color multiplies the raw 0-255 channels and saturates, so most products come out as 255, and Color/Color is the raw integer quotient.
+// COLOR_MODULATE_NORMALIZED: Treats channels as fractions of 255, the usual meaning for tinting and blending.  Color*Color gives (a*b+127)/255, so WHITE*c==c,
+// and Color/Color gives a*255/b rounded and saturated, so c/WHITE==c.  Each result is rounded to 8 bits, so (c*d)/d only approximates c, and less closely the darker d is.  Both are computed with exact integer multiply-and-shift, without any division.
+//
+// (F) Single or multiple translation units
+//
+// By default every overload is an ordinary (non-inline) function and RaylibOpOverloads.hpp compiles the raygui implementation in, so the headers may be included in only one .cpp file.
+// INLINE_OVERLOADS: Declares every overload inline, and constexpr where the math allows (e.g. the Color operators), so the headers
+// can be included in any number of translation units and the operators can be inlined into hot loops everywhere.  The vector operators are templates, constexpr either way (all but the operator== of EQUALITY_OPERATOR_KNUTH).  RAYGUI_IMPLEMENTATION is then no longer defined:
+// write #define RAYGUI_IMPLEMENTATION before including RaylibOpOverloads.hpp in exactly one .cpp file, or include raygui.h with it yourself.
+// The parts other than RaylibOpOverloads.hpp never include raygui.
+//
+// (G) Division by zero
+//
+// Vector2 and Vector3 operator/ multiply by the reciprocal of the scalar.  What happens when the scalar is zero is up to you:
+// DIVISION_BY_ZERO_THROW: Prints an error to stderr and throws std::domain_error (RayLib has no such check).  This was the only behavior in earlier versions.
+// DIVISION_BY_ZERO_ASSERT: assert()s in debug builds.  With NDEBUG defined the division is a plain reciprocal multiply, which the compiler can inline and vectorize.
+// DIVISION_BY_ZERO_IEEE: No check at all.  The result follows IEEE float rules, i.e. components become inf or nan.
+// DIVISION_BY_ZERO_RETURN_ZERO: Dividing by zero gives the zero vector.  Branch-free.
+// Define one of these.  Individual calls can override the choice with a tag, e.g. RaylibOps::Divide(v,s,RaylibOps::DivisionIEEE()).
+//
+// (H) Instrumentation
+//
+// INSTRUMENT_OVERLOADS: Counts the calls of each operator, per type, in thread-local counters which RaylibOps::Instrumentation::Report(std::cout) prints.
+// Shows which operators dominate a frame, e.g. to decide which ones deserve a batched or SIMD rewrite.  Costs an increment per call, and the constexpr of INLINE_OVERLOADS.
+// INSTRUMENT_OVERLOADS_CYCLES: Also times a sample of the calls with rdtsc, so the report includes the average cost of each operator.  Requires INSTRUMENT_OVERLOADS.
+//
+// (I) Options from the build
+//
+// RAYLIBOPS_CUSTOM_OPTIONS: Skips the defaults below, so that every option comes from the compiler command line instead, e.g.
+// -DRAYLIBOPS_CUSTOM_OPTIONS -DPRINT_VECTORS_BY_COMPONENT -DEQUALITY_OPERATOR_SIMPLE.  One PRINT_VECTORS_ option is then still required.
+// The test and benchmark targets of CMakeLists.txt build each combination of options this way.
+
+#ifndef RAYLIBOPS_CUSTOM_OPTIONS
+#define PRINT_VECTORS_WITH_PARENTHESES
+//#define PRINT_VECTORS_BY_COMPONENT
+
+//#define EQUALITY_OPERATOR_SIMPLE
+#define EQUALITY_OPERATOR_KNUTH
+
+//#define VECTOR_EXPRESSION_TEMPLATES
+
+//#define DISABLE_SIMD
+
+//#define COLOR_MODULATE_NORMALIZED
+
+//#define INLINE_OVERLOADS
+
+#define DIVISION_BY_ZERO_THROW
+//#define DIVISION_BY_ZERO_ASSERT
+//#define DIVISION_BY_ZERO_IEEE
+//#define DIVISION_BY_ZERO_RETURN_ZERO
+
+//#define INSTRUMENT_OVERLOADS
+//#define INSTRUMENT_OVERLOADS_CYCLES
+#endif // RAYLIBOPS_CUSTOM_OPTIONS
+
+#if defined(INLINE_OVERLOADS) && defined(INSTRUMENT_OVERLOADS)
+#define RAYLIBOPS_INLINE inline
+#define RAYLIBOPS_CONSTEXPR inline  //Counting a call is not allowed in a constant expression
+#elif defined(INLINE_OVERLOADS)
+#define RAYLIBOPS_INLINE inline
+#define RAYLIBOPS_CONSTEXPR constexpr
+#else
+#define RAYLIBOPS_INLINE
+#define RAYLIBOPS_CONSTEXPR
+#endif
+//The operator templates need no inline to be included anywhere, so they are constexpr in every configuration but instrumented ones
+#ifdef INSTRUMENT_OVERLOADS
+#define RAYLIBOPS_TEMPLATE_CONSTEXPR
+#else
+#define RAYLIBOPS_TEMPLATE_CONSTEXPR constexpr
+#endif
+
+// **************************************
+//
+// INSTRUMENTATION
+//
+// **************************************
+//
+// With INSTRUMENT_OVERLOADS defined (option H in RaylibOpsConfig.hpp), each operator on Vector2, Vector3, Vector4, Matrix and Color, and each operator<<, counts its calls.
+// The integer vectors are not counted.
+// The counters live in thread-local storage, so counting costs a plain increment and threads never contend.  RaylibOps::Instrumentation::Snapshot() adds up every
+// thread's counts since the last Reset(), and Report(os) prints them, busiest first.  E.g. call Instrumentation::Reset() before a frame and Report(std::cout) after it.
+// INSTRUMENT_OVERLOADS_CYCLES also times one call in every CycleSampleInterval with the time stamp counter (rdtsc on x86, std::chrono::steady_clock elsewhere),
+// so that the report estimates the ticks each operator costs.  Compound assignments written in terms of the plain operator, e.g. Vector2 *=, count a call of both.
+// The vector operators built by VECTOR_EXPRESSION_TEMPLATES are not counted.  Without INSTRUMENT_OVERLOADS, RAYLIBOPS_COUNT() expands to nothing.
+
+#ifdef INSTRUMENT_OVERLOADS
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <ostream>
+#if defined(INSTRUMENT_OVERLOADS_CYCLES) && defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define RAYLIBOPS_RDTSC
+#elif defined(INSTRUMENT_OVERLOADS_CYCLES) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define RAYLIBOPS_RDTSC
+#elif defined(INSTRUMENT_OVERLOADS_CYCLES)
+#include <chrono>
+#endif
+
+namespace RaylibOps {
+namespace Instrumentation {
+
+enum class Counter {
+    Vector2Add, Vector2AddAssign, Vector2Negate, Vector2Subtract, Vector2SubtractAssign, Vector2Scale, Vector2ScaleAssign, Vector2Divide, Vector2DivideAssign, Vector2Equal,
+    Vector3Add, Vector3AddAssign, Vector3Negate, Vector3Subtract, Vector3SubtractAssign, Vector3Scale, Vector3ScaleAssign, Vector3Divide, Vector3DivideAssign, Vector3Equal,
+    Vector4Add, Vector4AddAssign, Vector4Negate, Vector4Subtract, Vector4SubtractAssign, Vector4Scale, Vector4ScaleAssign, Vector4Divide, Vector4DivideAssign, Vector4Equal,
+    MatrixAdd, MatrixAddAssign, MatrixSubtract, MatrixSubtractAssign, MatrixMultiply, MatrixMultiplyAssign, MatrixTransformVector3, MatrixTransformVector4,
+    ColorAdd, ColorAddAssign, ColorSubtract, ColorSubtractAssign, ColorMultiply, ColorMultiplyAssign, ColorScale, ColorScaleAssign,
+    ColorDivide, ColorDivideAssign, ColorDivideScalar, ColorDivideScalarAssign, ColorEqual,
+    PrintVector2, PrintVector3, PrintVector4, PrintColor, PrintMatrix, PrintRectangle, PrintImage, PrintTexture, PrintCamera2D, PrintCamera3D,
+    PrintRay, PrintRayHitInfo, PrintBoundingBox, PrintNPatchInfo, PrintCharInfo, PrintFont, PrintCameraSnapshot2D, PrintCameraSnapshot,
+    Count
+};
+
+const int CounterCount=(int)Counter::Count;
+
+//Indexed by Counter
+constexpr const char* CounterNames[]={
+    "Vector2 operator+", "Vector2 operator+=", "Vector2 unary operator-", "Vector2 operator-", "Vector2 operator-=", "Vector2 operator*(float)", "Vector2 operator*=(float)",
+    "Vector2 operator/(float)", "Vector2 operator/=(float)", "Vector2 operator==",
+    "Vector3 operator+", "Vector3 operator+=", "Vector3 unary operator-", "Vector3 operator-", "Vector3 operator-=", "Vector3 operator*(float)", "Vector3 operator*=(float)",
+    "Vector3 operator/(float)", "Vector3 operator/=(float)", "Vector3 operator==",
+    "Vector4 operator+", "Vector4 operator+=", "Vector4 unary operator-", "Vector4 operator-", "Vector4 operator-=", "Vector4 operator*(float)", "Vector4 operator*=(float)",
+    "Vector4 operator/(float)", "Vector4 operator/=(float)", "Vector4 operator==",
+    "Matrix operator+", "Matrix operator+=", "Matrix operator-", "Matrix operator-=", "Matrix operator*", "Matrix operator*=", "Matrix operator*(Vector3)", "Matrix operator*(Vector4)",
+    "Color operator+", "Color operator+=", "Color operator-", "Color operator-=", "Color operator*(Color)", "Color operator*=(Color)", "Color operator*(float)", "Color operator*=(float)",
+    "Color operator/(Color)", "Color operator/=(Color)", "Color operator/(float)", "Color operator/=(float)", "Color operator==",
+    "operator<<(Vector2)", "operator<<(Vector3)", "operator<<(Vector4)", "operator<<(Color)", "operator<<(Matrix)", "operator<<(Rectangle)", "operator<<(Image)", "operator<<(Texture)",
+    "operator<<(Camera2D)", "operator<<(Camera3D)", "operator<<(Ray)", "operator<<(RayHitInfo)", "operator<<(BoundingBox)", "operator<<(NPatchInfo)", "operator<<(CharInfo)",
+    "operator<<(Font)", "operator<<(CameraSnapshot2D)", "operator<<(CameraSnapshot)"
+};
+
+static_assert(sizeof(CounterNames)/sizeof(CounterNames[0])==CounterCount, "CounterNames needs one name per Counter");
+
+const std::uint64_t CycleSampleInterval=64;
+
+struct CounterTotals {
+    std::uint64_t calls[CounterCount];
+    std::uint64_t samples[CounterCount];  //Calls which were timed
+    std::uint64_t ticks[CounterCount];  //Time stamp counter ticks spent in the timed calls
+};
+
+//One per thread.  Only the owning thread writes its counters, so relaxed loads and stores are enough, and Snapshot() can read them at any time.
+struct ThreadCounters {
+    ThreadCounters();
+    ~ThreadCounters();
+
+    std::atomic<std::uint64_t> calls[CounterCount];
+    std::atomic<std::uint64_t> samples[CounterCount];
+    std::atomic<std::uint64_t> ticks[CounterCount];
+};
+
+struct Registry {
+    std::mutex lock;
+    std::vector<ThreadCounters*> threads;
+    CounterTotals retired;  //Counts of threads which have exited
+    CounterTotals baseline;  //The totals at the last Reset()
+};
+
+//Never destroyed, since worker threads may still exit and retire their counters after static destructors have run
+RAYLIBOPS_INLINE Registry& GetRegistry() {
+    static Registry* registry=new Registry();
+return *registry;
+}
+
+RAYLIBOPS_INLINE ThreadCounters::ThreadCounters() {
+    for (int i=0; i<CounterCount; i++) {
+        calls[i].store(0,std::memory_order_relaxed);
+        samples[i].store(0,std::memory_order_relaxed);
+        ticks[i].store(0,std::memory_order_relaxed);
+    }
+    Registry& r=GetRegistry();
+    std::lock_guard<std::mutex> guard(r.lock);
+    r.threads.push_back(this);
+}
+
+RAYLIBOPS_INLINE ThreadCounters::~ThreadCounters() {
+    Registry& r=GetRegistry();
+    std::lock_guard<std::mutex> guard(r.lock);
+    for (int i=0; i<CounterCount; i++) {
+        r.retired.calls[i]+=calls[i].load(std::memory_order_relaxed);
+        r.retired.samples[i]+=samples[i].load(std::memory_order_relaxed);
+        r.retired.ticks[i]+=ticks[i].load(std::memory_order_relaxed);
+    }
+    r.threads.erase(std::find(r.threads.begin(),r.threads.end(),this));
+}
+
+RAYLIBOPS_INLINE ThreadCounters& LocalCounters() {
+    thread_local ThreadCounters counters;
+return counters;
+}
+
+RAYLIBOPS_INLINE std::uint64_t Ticks() {
+#if defined(RAYLIBOPS_RDTSC)
+return __rdtsc();
+#elif defined(INSTRUMENT_OVERLOADS_CYCLES)
+return (std::uint64_t)std::chrono::steady_clock::now().time_since_epoch().count();
+#else
+return 0;
+#endif
+}
+
+//Counts one call for as long as it is in scope, and times it if it is a sampled one
+class Scope {
+public:
+    explicit Scope(Counter c) : counters(LocalCounters()), index((int)c), start(0) {
+        std::uint64_t n=counters.calls[index].load(std::memory_order_relaxed);
+        counters.calls[index].store(n+1,std::memory_order_relaxed);
+#ifdef INSTRUMENT_OVERLOADS_CYCLES
+        sampled=(n%CycleSampleInterval==0);
+        if (sampled) start=Ticks();
+#endif
+    }
+
+    ~Scope() {
+#ifdef INSTRUMENT_OVERLOADS_CYCLES
+        if (sampled) {
+            std::uint64_t elapsed=Ticks()-start;
+            counters.samples[index].store(counters.samples[index].load(std::memory_order_relaxed)+1,std::memory_order_relaxed);
+            counters.ticks[index].store(counters.ticks[index].load(std::memory_order_relaxed)+elapsed,std::memory_order_relaxed);
+        }
+#endif
+    }
+
+    Scope(const Scope&)=delete;
+    Scope& operator=(const Scope&)=delete;
+
+private:
+    ThreadCounters& counters;
+    int index;
+    std::uint64_t start;
+#ifdef INSTRUMENT_OVERLOADS_CYCLES
+    bool sampled;
+#endif
+};
+
+//Every thread's totals, including those which have exited, without subtracting the baseline.  r.lock must be held.
+RAYLIBOPS_INLINE CounterTotals SumCounters(const Registry& r) {
+    CounterTotals t=r.retired;
+    for (const ThreadCounters* c : r.threads) {
+        for (int i=0; i<CounterCount; i++) {
+            t.calls[i]+=c->calls[i].load(std::memory_order_relaxed);
+            t.samples[i]+=c->samples[i].load(std::memory_order_relaxed);
+            t.ticks[i]+=c->ticks[i].load(std::memory_order_relaxed);
+        }
+    }
+return t;
+}
+
+//Counts since the last Reset(), or since the program started
+RAYLIBOPS_INLINE CounterTotals Snapshot() {
+    Registry& r=GetRegistry();
+    std::lock_guard<std::mutex> guard(r.lock);
+    CounterTotals t=SumCounters(r);
+    for (int i=0; i<CounterCount; i++) {
+        t.calls[i]-=r.baseline.calls[i];
+        t.samples[i]-=r.baseline.samples[i];
+        t.ticks[i]-=r.baseline.ticks[i];
+    }
+return t;
+}
+
+//Starts counting from zero.  No counter is written, so threads may keep counting meanwhile.
+RAYLIBOPS_INLINE void Reset() {
+    Registry& r=GetRegistry();
+    std::lock_guard<std::mutex> guard(r.lock);
+    r.baseline=SumCounters(r);
+}
+
+//One line per operator which was called, most calls first, with the estimated ticks per call if INSTRUMENT_OVERLOADS_CYCLES is defined
+RAYLIBOPS_INLINE void Report(std::ostream& os, const CounterTotals& t) {
+    int order[CounterCount];
+    for (int i=0; i<CounterCount; i++) order[i]=i;
+    std::stable_sort(order,order+CounterCount,[&t](int a, int b) { return t.calls[a]>t.calls[b]; });
+    for (int k=0; k<CounterCount && t.calls[order[k]]>0; k++) {
+        int i=order[k];
+        os<<CounterNames[i]<<": "<<t.calls[i]<<" calls";
+        if (t.samples[i]>0) os<<", "<<(double)t.ticks[i]/(double)t.samples[i]<<" ticks per call";
+        os<<"\n";
+    }
+}
+
+RAYLIBOPS_INLINE void Report(std::ostream& os) {
+    Report(os,Snapshot());
+}
+
+//The vector operators are templates, so they find their counter from the vector type: each of Vector2, Vector3 and Vector4 has these ten counters in this order
+enum class VectorOperation { Add, AddAssign, Negate, Subtract, SubtractAssign, Scale, ScaleAssign, Divide, DivideAssign, Equal };
+
+//First counter of vector type V, or -1 for the vectors which are not counted (the integer vectors)
+template<typename V> struct VectorCounters { static const int First=-1; };
+template<> struct VectorCounters<Vector2> { static const int First=(int)Counter::Vector2Add; };
+template<> struct VectorCounters<Vector3> { static const int First=(int)Counter::Vector3Add; };
+template<> struct VectorCounters<Vector4> { static const int First=(int)Counter::Vector4Add; };
+
+template<typename V, bool Counted=(VectorCounters<V>::First>=0)> struct VectorScope {
+    explicit VectorScope(VectorOperation) {}
+};
+
+template<typename V> struct VectorScope<V,true> : Scope {
+    explicit VectorScope(VectorOperation op) : Scope((Counter)(VectorCounters<V>::First+(int)op)) {}
+};
+
+} // namespace Instrumentation
+} // namespace RaylibOps
+
+#define RAYLIBOPS_COUNT(counter) RaylibOps::Instrumentation::Scope raylibops_count(RaylibOps::Instrumentation::Counter::counter)
+#define RAYLIBOPS_COUNT_VECTOR(V,operation) RaylibOps::Instrumentation::VectorScope<V> raylibops_count(RaylibOps::Instrumentation::VectorOperation::operation)
+#else
+#define RAYLIBOPS_COUNT(counter)
+#define RAYLIBOPS_COUNT_VECTOR(V,operation)
+#endif // INSTRUMENT_OVERLOADS
+
+#endif // RAYLIBOPS_CONFIG_HPP_INCLUDED
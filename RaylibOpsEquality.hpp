@@ -0,0 +1,141 @@
+#ifndef RAYLIBOPS_EQUALITY_HPP_INCLUDED
+#define RAYLIBOPS_EQUALITY_HPP_INCLUDED
+#include "RaylibOpsArithmetic.hpp"
+
+// **************************************************************
+//
+//      C++ Operator Overloads for RayLib: equality
+//
+// **************************************************************
+//
+// operator== for colors and vectors, and the tolerances behind it, which the batched comparisons and the spatial hash also use.
+
+// Equality operator overloads
+//
+// Integer equality
+RAYLIBOPS_CONSTEXPR bool operator==(const Color& c1, const Color& c2) {
+    RAYLIBOPS_COUNT(ColorEqual);
+    if ( (c1.r==c2.r) && (c1.g==c2.g) && (c1.b==c2.b) && (c1.a==c2.a) ) return true;
+return false;
+}
+
+// Float equality for Vector2, Vector3 and Vector4
+//
+// Tolerances.  Each is a type whose Equal(a,b) compares two floats without branching, and whose EqualBits() compares FloatWidth lanes at once, returning one bit per lane.
+// Pass one as a template argument to RaylibOps::ApproximatelyEqual(), or to the bulk comparisons of the batched section below, e.g. ApproximatelyEqual< UlpTolerance<4> >(v1,v2).
+//
+// RelativeTolerance<N>: Knuth's "essentially equal" within N machine epsilons, |a-b| <= min(|a|,|b|)*N*epsilon.  RelativeTolerance<1> is exactly EQUALITY_OPERATOR_KNUTH.
+// UlpTolerance<N>: Equal if a and b are at most N representable floats apart, counting across zero.  Unlike the relative test, this one considers tiny numbers near zero equal to zero.
+// ExactTolerance: a==b, i.e. EQUALITY_OPERATOR_SIMPLE.
+// NaN never equals anything under any of them.  Reach(a) bounds |a-b| for every b which Equal()s a, which lets the spatial hash below know how far to look.
+#include <limits>
+#include <cstdint>
+#include <cstring>
+namespace RaylibOps {
+
+template<unsigned int Multiple> struct RelativeTolerance {
+    static constexpr float Epsilon=Multiple*std::numeric_limits<float>::epsilon();
+
+    static bool Equal(float a, float b) {
+        float fa=std::fabs(a), fb=std::fabs(b);
+    return std::fabs(a-b) <= ( (fa>fb ? fb : fa) * Epsilon );
+    }
+
+    static unsigned int EqualBits(Simd::Floats a, Simd::Floats b) {
+    return Simd::LessEqualBits(Simd::Abs(Simd::Subtract(a,b)), Simd::Multiply(Simd::Min(Simd::Abs(a),Simd::Abs(b)),Simd::Splat(Epsilon)));
+    }
+
+    static float Reach(float a) { return std::fabs(a)*Epsilon; }
+};
+
+//Maps the bits of a float to an integer which orders like the float: sign and magnitude to two's complement.  -0 and +0 both map to 0.
+RAYLIBOPS_INLINE std::int32_t OrderedFloatBits(float f) {
+    std::int32_t i;
+    std::memcpy(&i,&f,sizeof(i));
+    std::int32_t sign=i>>31;
+return ((i&0x7fffffff)^sign)-sign;
+}
+
+#if defined(RAYLIBOPS_SIMD_AVX) || defined(RAYLIBOPS_SIMD_SSE)
+//Four lanes of UlpTolerance<Ulps>::Equal().  AVX builds use it on each 128-bit half, since plain AVX has no 256-bit integer instructions.
+RAYLIBOPS_INLINE unsigned int UlpEqualBits(__m128 a, __m128 b, unsigned int ulps) {
+    __m128i magnitude=_mm_set1_epi32(0x7fffffff), ia=_mm_castps_si128(a), ib=_mm_castps_si128(b);
+    __m128i sa=_mm_srai_epi32(ia,31), sb=_mm_srai_epi32(ib,31);
+    __m128i oa=_mm_sub_epi32(_mm_xor_si128(_mm_and_si128(ia,magnitude),sa),sa);
+    __m128i ob=_mm_sub_epi32(_mm_xor_si128(_mm_and_si128(ib,magnitude),sb),sb);
+    __m128i distance=_mm_add_epi32(_mm_sub_epi32(oa,ob),_mm_set1_epi32((int)ulps));
+    __m128i flip=_mm_set1_epi32((int)0x80000000u);  //Unsigned distance>2*ulps, done as a signed compare with the sign bits flipped
+    __m128i outside=_mm_cmpgt_epi32(_mm_xor_si128(distance,flip),_mm_set1_epi32((int)((2u*ulps)^0x80000000u)));
+return ~(unsigned int)_mm_movemask_ps(_mm_castsi128_ps(outside)) & (unsigned int)_mm_movemask_ps(_mm_cmpord_ps(a,b)) & 0xFu;
+}
+#endif
+
+template<unsigned int Ulps> struct UlpTolerance {
+    static bool Equal(float a, float b) {
+        std::uint32_t distance=(std::uint32_t)OrderedFloatBits(a)-(std::uint32_t)OrderedFloatBits(b)+Ulps;  //Within [-Ulps,Ulps] becomes within [0,2*Ulps]
+    return (distance<=2u*Ulps) & (a==a) & (b==b);
+    }
+
+    static unsigned int EqualBits(Simd::Floats a, Simd::Floats b) {
+#if defined(RAYLIBOPS_SIMD_AVX)
+    return UlpEqualBits(_mm256_castps256_ps128(a),_mm256_castps256_ps128(b),Ulps) | (UlpEqualBits(_mm256_extractf128_ps(a,1),_mm256_extractf128_ps(b,1),Ulps)<<4);
+#elif defined(RAYLIBOPS_SIMD_SSE)
+    return UlpEqualBits(a,b,Ulps);
+#elif defined(RAYLIBOPS_SIMD_NEON)
+        int32x4_t magnitude=vdupq_n_s32(0x7fffffff), ia=vreinterpretq_s32_f32(a), ib=vreinterpretq_s32_f32(b);
+        int32x4_t sa=vshrq_n_s32(ia,31), sb=vshrq_n_s32(ib,31);
+        int32x4_t oa=vsubq_s32(veorq_s32(vandq_s32(ia,magnitude),sa),sa);
+        int32x4_t ob=vsubq_s32(veorq_s32(vandq_s32(ib,magnitude),sb),sb);
+        uint32x4_t distance=vreinterpretq_u32_s32(vaddq_s32(vsubq_s32(oa,ob),vdupq_n_s32((int)Ulps)));
+    return Simd::MaskBits(vandq_u32(vcleq_u32(distance,vdupq_n_u32(2u*Ulps)),vandq_u32(vceqq_f32(a,a),vceqq_f32(b,b))));
+#else
+    return Equal(a,b)?1u:0u;
+#endif
+    }
+
+    static float Reach(float a) { return 2.0f*Ulps*(std::fabs(a)*std::numeric_limits<float>::epsilon()+std::numeric_limits<float>::denorm_min()); }  //The spacing of floats at most doubles within Ulps of a
+};
+
+struct ExactTolerance {
+    template<typename T> static constexpr bool Equal(T a, T b) { return a==b; }
+    static unsigned int EqualBits(Simd::Floats a, Simd::Floats b) { return Simd::LessEqualBits(a,b) & Simd::LessEqualBits(b,a); }
+    static float Reach(float) { return 0.0f; }
+};
+
+typedef RelativeTolerance<1> KnuthTolerance;
+
+//The tolerance matching the EQUALITY_OPERATOR_ choice in RaylibOpsConfig.hpp, used by default by the bulk comparisons
+#ifdef EQUALITY_OPERATOR_SIMPLE
+typedef ExactTolerance DefaultTolerance;
+#else
+typedef KnuthTolerance DefaultTolerance;
+#endif
+
+//Componentwise comparison of Vector2, Vector3 or Vector4, which combines the results with & rather than &&, so there is no early exit to branch on
+template<typename Tolerance, typename V> constexpr FloatVector<V,bool> ApproximatelyEqual(const V& a, const V& b) {
+return AllComponents<Tolerance>(a,b);
+}
+
+} // namespace RaylibOps
+
+//Integer vectors compare exactly, whatever the EQUALITY_OPERATOR_ option
+template<typename V> RAYLIBOPS_TEMPLATE_CONSTEXPR RaylibOps::IntegerVector<V,bool> operator==(const V& a, const V& b) {
+return RaylibOps::AllComponents<RaylibOps::ExactTolerance>(a,b);
+}
+
+//As with the arithmetic operators, so that a==b on two Vector2i works in any namespace
+namespace RaylibOps {
+using ::operator==;
+}
+
+//Comparing float values requires care.  Choose EQUALITY_OPERATOR_SIMPLE, EQUALITY_OPERATOR_KNUTH, or neither in the #defines of RaylibOpsConfig.hpp
+//_SIMPLE compares each component with ==, and is constexpr.  _KNUTH takes a conservative approach and only affirms that two vectors are equal if all of their respective
+//components are equal within machine precision.  Both are DefaultTolerance.
+#if defined(EQUALITY_OPERATOR_SIMPLE) || defined(EQUALITY_OPERATOR_KNUTH)
+template<typename V> RAYLIBOPS_TEMPLATE_CONSTEXPR RaylibOps::FloatVector<V,bool> operator==(const V& a, const V& b) {
+    RAYLIBOPS_COUNT_VECTOR(V,Equal);
+return RaylibOps::ApproximatelyEqual<RaylibOps::DefaultTolerance>(a,b);
+}
+#endif
+
+#endif // RAYLIBOPS_EQUALITY_HPP_INCLUDED
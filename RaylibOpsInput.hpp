@@ -0,0 +1,546 @@
+#ifndef RAYLIBOPS_INPUT_HPP_INCLUDED
+#define RAYLIBOPS_INPUT_HPP_INCLUDED
+#include "RaylibOpsOutput.hpp"
+
+// **************************************************************
+//
+//      C++ Operator Overloads for RayLib: input and serialization
+//
+// **************************************************************
+//
+// operator>> reading back what operator<< writes, and the binary WriteBinary() and ReadBinary().
+
+// ********************************************
+//
+//           INPUT STREAM OVERLOADS
+//
+// ********************************************
+// operator>> reads back what operator<< writes for Vector2, Vector3, Vector4, Color, Matrix and Rectangle.  Both print formats are accepted whichever one is
+// selected in RaylibOpsConfig.hpp: "(1,2,3)" or "x=1, y=2, z=3" for vectors, "(255,0,0,255)" or "R=255 G=0 B=0 A=255" for colors.  Whitespace between parts
+// is ignored, as are the showpos '+' and hexfloat output, but a label such as "Rectangle corner:" must match exactly.  On a parse error the stream's failbit
+// is set and the value is left unchanged.
+//
+// Numbers are parsed with std::from_chars, which is exact: text printed with 9 significant digits, e.g. after os<<std::setprecision(9), reads back as the very same float.
+// For large dumps, parse straight from memory without a stream: RaylibOps::FromChars(first,last,value) parses one value, FromChars(first,last,values,n) parses n of them
+// and FromChars(first,last,vector) appends every value up to the end of the text.  Like std::from_chars they return {ptr,ec}; on an error ptr is where parsing stopped.
+
+#include <istream>
+#include <vector>
+
+namespace RaylibOps {
+
+//Parses a float as TextFormatter writes it: std::from_chars, plus the leading '+' of showpos and the "0x" prefix of hexfloat
+RAYLIBOPS_INLINE std::from_chars_result ParseFloat(const char* first, const char* last, float& value) {
+    const char* p=first;
+    bool negative=false;
+    if (p<last && (*p=='+' || *p=='-')) {
+        negative=(*p=='-');
+        p++;
+    }
+    std::chars_format format=std::chars_format::general;
+    if (last-p>2 && p[0]=='0' && (p[1]=='x' || p[1]=='X')) {
+        p+=2;
+        format=std::chars_format::hex;
+    }
+    if (p==last || *p=='+' || *p=='-') return {first,std::errc::invalid_argument};
+    float parsed;
+    std::from_chars_result r=std::from_chars(p,last,parsed,format);
+    if (r.ec==std::errc::invalid_argument) r.ptr=first;
+    if (r.ec==std::errc()) value=negative?-parsed:parsed;
+return r;
+}
+
+//Reads from a char range
+class TextParser {
+public:
+    TextParser(const char* first, const char* last) : cur(first), end(last), error() {}
+
+    //The next character after any whitespace, or -1 at the end
+    int Peek() {
+        SkipSpace();
+    return (cur<end)?(unsigned char)*cur:-1;
+    }
+
+    bool Expect(char c) {
+        SkipSpace();
+        if (cur<end && *cur==c) {
+            cur++;
+        return true;
+        }
+    return Fail(std::errc::invalid_argument);
+    }
+
+    //Matches text exactly, spaces included, after any whitespace before it
+    bool Expect(const char* text) {
+        SkipSpace();
+        for (; *text; text++, cur++) {
+            if (cur==end || *cur!=*text) return Fail(std::errc::invalid_argument);
+        }
+    return true;
+    }
+
+    bool Number(float& value) {
+        SkipSpace();
+        std::from_chars_result r=ParseFloat(cur,end,value);
+        if (r.ec!=std::errc()) return Fail(r.ec);
+        cur=r.ptr;
+    return true;
+    }
+
+    bool Number(unsigned char& value) {
+        SkipSpace();
+        unsigned int u;
+        std::from_chars_result r=std::from_chars(cur,end,u);
+        if (r.ec!=std::errc()) return Fail(r.ec);
+        if (u>255) return Fail(std::errc::result_out_of_range);
+        cur=r.ptr;
+        value=(unsigned char)u;
+    return true;
+    }
+
+    const char* position() const { return cur; }
+    std::errc status() const { return error; }
+
+private:
+    void SkipSpace() { while (cur<end && std::isspace((unsigned char)*cur)) cur++; }
+    bool Fail(std::errc e) {
+        if (error==std::errc()) error=e;
+    return false;
+    }
+
+    const char* cur;
+    const char* end;
+    std::errc error;
+};
+
+//Reads from a stream buffer one character at a time, taking only the characters which belong to the value
+class StreamParser {
+public:
+    explicit StreamParser(std::streambuf& buffer) : buf(buffer), atEnd(false) {}
+
+    int Peek() {
+        SkipSpace();
+    return Current();
+    }
+
+    bool Expect(char c) {
+        SkipSpace();
+        if (Current()!=(unsigned char)c) return false;
+        buf.sbumpc();
+    return true;
+    }
+
+    bool Expect(const char* text) {
+        SkipSpace();
+        for (; *text; text++) {
+            if (Current()!=(unsigned char)*text) return false;
+            buf.sbumpc();
+        }
+    return true;
+    }
+
+    //Collects the characters a float can be made of into a token, then parses the whole token
+    bool Number(float& value) {
+        SkipSpace();
+        Token token;
+        if (Current()=='+' || Current()=='-') Take(token);
+        if (std::isalpha(Current())) {
+            //inf, infinity or nan: take letters only while they still spell one of these, so a following label is not swallowed
+            std::size_t start=token.length;
+            while (std::isalpha(Current()) && (Spells(token,start,"infinity") || Spells(token,start,"nan"))) Take(token);
+        }
+        else {
+            bool hex=false;
+            if (Current()=='0') {
+                Take(token);
+                if (Current()=='x' || Current()=='X') {
+                    Take(token);
+                    hex=true;
+                }
+            }
+            while (Current()=='.' || (hex?std::isxdigit(Current()):std::isdigit(Current()))) Take(token);
+            int c=Current();
+            if (hex?(c=='p' || c=='P'):(c=='e' || c=='E')) {
+                Take(token);
+                if (Current()=='+' || Current()=='-') Take(token);
+                while (std::isdigit(Current())) Take(token);
+            }
+        }
+        if (token.length>sizeof(token.text)) return false;
+        float parsed;
+        std::from_chars_result r=ParseFloat(token.text,token.text+token.length,parsed);
+        if (r.ec!=std::errc() || r.ptr!=token.text+token.length) return false;
+        value=parsed;
+    return true;
+    }
+
+    bool Number(unsigned char& value) {
+        SkipSpace();
+        Token token;
+        while (std::isdigit(Current())) Take(token);
+        if (token.length>sizeof(token.text)) return false;
+        unsigned int u;
+        std::from_chars_result r=std::from_chars(token.text,token.text+token.length,u);
+        if (r.ec!=std::errc() || r.ptr!=token.text+token.length || u>255) return false;
+        value=(unsigned char)u;
+    return true;
+    }
+
+    bool eof() const { return atEnd; }
+
+private:
+    struct Token {
+        char text[64];
+        std::size_t length=0;
+    };
+
+    //True if the letters from start on, followed by the current character, begin word
+    bool Spells(const Token& token, std::size_t start, const char* word) {
+        std::size_t n=token.length-start;
+        if (n>=std::strlen(word) || std::tolower(Current())!=word[n]) return false;
+        for (std::size_t i=0; i<n; i++) {
+            if (std::tolower((unsigned char)token.text[start+i])!=word[i]) return false;
+        }
+    return true;
+    }
+
+    //The current character, or -1 at the end
+    int Current() {
+        std::streambuf::int_type c=buf.sgetc();
+        if (std::streambuf::traits_type::eq_int_type(c,std::streambuf::traits_type::eof())) {
+            atEnd=true;
+        return -1;
+        }
+    return (unsigned char)std::streambuf::traits_type::to_char_type(c);
+    }
+
+    //Moves the current character into the token; an overlong token keeps counting so it fails
+    void Take(Token& token) {
+        char c=std::streambuf::traits_type::to_char_type(buf.sbumpc());
+        if (token.length<sizeof(token.text)) token.text[token.length]=c;
+        token.length++;
+    }
+
+    void SkipSpace() { while (Current()!=-1 && std::isspace(Current())) buf.sbumpc(); }
+
+    std::streambuf& buf;
+    bool atEnd;
+};
+
+//Parses n floats in either vector format, labeled x, y, z, w
+template<typename Parser> bool ParseComponents(Parser& in, float* c, int n) {
+    if (in.Peek()=='(') {
+        in.Expect('(');
+        for (int i=0; i<n; i++) {
+            if ((i>0 && !in.Expect(',')) || !in.Number(c[i])) return false;
+        }
+    return in.Expect(')');
+    }
+    for (int i=0; i<n; i++) {
+        if ((i>0 && !in.Expect(',')) || !in.Expect("xyzw"[i]) || !in.Expect('=') || !in.Number(c[i])) return false;
+    }
+return true;
+}
+
+template<typename Parser> bool Parse(Parser& in, Vector2& v) {
+    float c[2];
+    if (!ParseComponents(in,c,2)) return false;
+    v=Vector2{c[0],c[1]};
+return true;
+}
+
+template<typename Parser> bool Parse(Parser& in, Vector3& v) {
+    float c[3];
+    if (!ParseComponents(in,c,3)) return false;
+    v=Vector3{c[0],c[1],c[2]};
+return true;
+}
+
+template<typename Parser> bool Parse(Parser& in, Vector4& v) {
+    float c[4];
+    if (!ParseComponents(in,c,4)) return false;
+    v=Vector4{c[0],c[1],c[2],c[3]};
+return true;
+}
+
+template<typename Parser> bool Parse(Parser& in, Color& col) {
+    unsigned char c[4];
+    if (in.Peek()=='(') {
+        in.Expect('(');
+        for (int i=0; i<4; i++) {
+            if ((i>0 && !in.Expect(',')) || !in.Number(c[i])) return false;
+        }
+        if (!in.Expect(')')) return false;
+    }
+    else {
+        for (int i=0; i<4; i++) {
+            if (!in.Expect("RGBA"[i]) || !in.Expect('=') || !in.Number(c[i])) return false;
+        }
+    }
+    col=Color{c[0],c[1],c[2],c[3]};
+return true;
+}
+
+//Sixteen numbers, in the row by row order operator<< prints them
+template<typename Parser> bool Parse(Parser& in, Matrix& m) {
+    static float Matrix::* const order[16]={&Matrix::m0,&Matrix::m4,&Matrix::m8,&Matrix::m12, &Matrix::m1,&Matrix::m5,&Matrix::m9,&Matrix::m13,
+                                            &Matrix::m2,&Matrix::m6,&Matrix::m10,&Matrix::m14, &Matrix::m3,&Matrix::m7,&Matrix::m11,&Matrix::m15};
+    Matrix parsed;
+    for (int i=0; i<16; i++) {
+        if (!in.Number(parsed.*order[i])) return false;
+    }
+    m=parsed;
+return true;
+}
+
+template<typename Parser> bool Parse(Parser& in, Rectangle& r) {
+    Rectangle parsed;
+    if (!in.Expect("Rectangle corner:") || !in.Expect('(') || !in.Number(parsed.x) || !in.Expect(',') || !in.Number(parsed.y) || !in.Expect(')') || !in.Expect(',') ||
+        !in.Expect("Width=") || !in.Number(parsed.width) || !in.Expect("Height=") || !in.Number(parsed.height)) return false;
+    r=parsed;
+return true;
+}
+
+template<typename T> std::istream& ReadFormatted(std::istream& is, T& value) {
+    std::istream::sentry ready(is);
+    if (!ready) return is;
+    StreamParser in(*is.rdbuf());
+    std::ios_base::iostate state=std::ios_base::goodbit;
+    if (!Parse(in,value)) state|=std::ios_base::failbit;
+    if (in.eof()) state|=std::ios_base::eofbit;
+    is.setstate(state);
+return is;
+}
+
+template<typename T> std::from_chars_result FromChars(const char* first, const char* last, T& value) {
+    TextParser in(first,last);
+    if (!Parse(in,value)) return {in.position(),in.status()};
+return {in.position(),std::errc()};
+}
+
+//Parses exactly n values
+template<typename T> std::from_chars_result FromChars(const char* first, const char* last, T* values, std::size_t n) {
+    TextParser in(first,last);
+    for (std::size_t i=0; i<n; i++) {
+        if (!Parse(in,values[i])) return {in.position(),in.status()};
+    }
+return {in.position(),std::errc()};
+}
+
+//Appends values until only whitespace is left
+template<typename T, typename A> std::from_chars_result FromChars(const char* first, const char* last, std::vector<T,A>& values) {
+    TextParser in(first,last);
+    while (in.Peek()!=-1) {
+        T value;
+        if (!Parse(in,value)) return {in.position(),in.status()};
+        values.push_back(value);
+    }
+return {in.position(),std::errc()};
+}
+
+} // namespace RaylibOps
+
+RAYLIBOPS_INLINE std::istream& operator>>(std::istream& is, Vector2& v) {
+return RaylibOps::ReadFormatted(is,v);
+}
+
+RAYLIBOPS_INLINE std::istream& operator>>(std::istream& is, Vector3& v) {
+return RaylibOps::ReadFormatted(is,v);
+}
+
+RAYLIBOPS_INLINE std::istream& operator>>(std::istream& is, Vector4& v) {
+return RaylibOps::ReadFormatted(is,v);
+}
+
+RAYLIBOPS_INLINE std::istream& operator>>(std::istream& is, Color& v) {
+return RaylibOps::ReadFormatted(is,v);
+}
+
+RAYLIBOPS_INLINE std::istream& operator>>(std::istream& is, Matrix& v) {
+return RaylibOps::ReadFormatted(is,v);
+}
+
+RAYLIBOPS_INLINE std::istream& operator>>(std::istream& is, Rectangle& v) {
+return RaylibOps::ReadFormatted(is,v);
+}
+
+// ********************************************
+//
+//           BINARY SERIALIZATION
+//
+// ********************************************
+// A binary counterpart to each operator<< above, for saving and replaying state without formatting and parsing text.
+// RaylibOps::WriteBinary(os,value) and RaylibOps::ReadBinary(is,value) write and read one value; WriteBinary(os,values,n) and ReadBinary(is,values,n) a whole array.
+// EncodeBinary() and DecodeBinary() do the same into and out of a byte buffer, returning the position just past the bytes used.
+//
+// The layout is fixed and does not depend on the platform: the fields in their declaration order, packed with no padding, each float, int and unsigned int as
+// 4 little-endian bytes (floats by their IEEE bits), each unsigned char and bool as 1 byte.  BinarySize<T>() gives the size of one value.
+// Pointers are not followed, just as operator<< doesn't print through them: an Image is written as width, height, mipmaps and format without its pixels,
+// and so is the image of a CharInfo, after its value, offsets and advance.  A Font is written without its recs or chars.  Reading sets those pointers to nullptr.
+// On little-endian machines, arrays of types whose layout is the same as their memory layout (everything but Image, RayHitInfo, CharInfo and Font) are
+// written and read with a single memcpy or stream write.  Read errors are reported through the stream state, as with operator>>.
+
+namespace RaylibOps {
+
+// BinaryFields() lists the serialized fields of each struct for an encoder, decoder or sizer, which are applied to each field in turn
+template<typename Io> constexpr void BinaryFields(Io& io, Vector2& v) { io.Field(v.x); io.Field(v.y); }
+template<typename Io> constexpr void BinaryFields(Io& io, Vector3& v) { io.Field(v.x); io.Field(v.y); io.Field(v.z); }
+template<typename Io> constexpr void BinaryFields(Io& io, Vector4& v) { io.Field(v.x); io.Field(v.y); io.Field(v.z); io.Field(v.w); }
+template<typename Io> constexpr void BinaryFields(Io& io, Color& c) { io.Field(c.r); io.Field(c.g); io.Field(c.b); io.Field(c.a); }
+template<typename Io> constexpr void BinaryFields(Io& io, Matrix& m) {
+    io.Field(m.m0); io.Field(m.m4); io.Field(m.m8); io.Field(m.m12);
+    io.Field(m.m1); io.Field(m.m5); io.Field(m.m9); io.Field(m.m13);
+    io.Field(m.m2); io.Field(m.m6); io.Field(m.m10); io.Field(m.m14);
+    io.Field(m.m3); io.Field(m.m7); io.Field(m.m11); io.Field(m.m15);
+}
+template<typename Io> constexpr void BinaryFields(Io& io, Rectangle& r) { io.Field(r.x); io.Field(r.y); io.Field(r.width); io.Field(r.height); }
+template<typename Io> constexpr void BinaryFields(Io& io, Image& i) { io.Field(i.width); io.Field(i.height); io.Field(i.mipmaps); io.Field(i.format); }
+template<typename Io> constexpr void BinaryFields(Io& io, Texture& t) { io.Field(t.id); io.Field(t.width); io.Field(t.height); io.Field(t.mipmaps); io.Field(t.format); }
+template<typename Io> constexpr void BinaryFields(Io& io, Camera2D& c) { io.Field(c.offset); io.Field(c.target); io.Field(c.rotation); io.Field(c.zoom); }
+template<typename Io> constexpr void BinaryFields(Io& io, Camera3D& c) { io.Field(c.position); io.Field(c.target); io.Field(c.up); io.Field(c.fovy); io.Field(c.projection); }
+template<typename Io> constexpr void BinaryFields(Io& io, Ray& r) { io.Field(r.position); io.Field(r.direction); }
+template<typename Io> constexpr void BinaryFields(Io& io, RayHitInfo& rhi) { io.Field(rhi.hit); io.Field(rhi.distance); io.Field(rhi.position); io.Field(rhi.normal); }
+template<typename Io> constexpr void BinaryFields(Io& io, BoundingBox& bb) { io.Field(bb.min); io.Field(bb.max); }
+template<typename Io> constexpr void BinaryFields(Io& io, NPatchInfo& np) { io.Field(np.source); io.Field(np.left); io.Field(np.top); io.Field(np.right); io.Field(np.bottom); io.Field(np.layout); }
+template<typename Io> constexpr void BinaryFields(Io& io, CharInfo& ci) { io.Field(ci.value); io.Field(ci.offsetX); io.Field(ci.offsetY); io.Field(ci.advanceX); io.Field(ci.image); }
+template<typename Io> constexpr void BinaryFields(Io& io, Font& f) { io.Field(f.baseSize); io.Field(f.charsCount); io.Field(f.charsPadding); io.Field(f.texture); }
+
+struct BinarySizer {
+    std::size_t bytes=0;
+    constexpr void Field(float) { bytes+=4; }
+    constexpr void Field(int) { bytes+=4; }
+    constexpr void Field(unsigned int) { bytes+=4; }
+    constexpr void Field(unsigned char) { bytes+=1; }
+    constexpr void Field(bool) { bytes+=1; }
+    template<typename S> constexpr void Field(S& s) { BinaryFields(*this,s); }
+};
+
+struct BinaryEncoder {
+    unsigned char* out;
+    void Field(std::uint32_t u) { out[0]=(unsigned char)u; out[1]=(unsigned char)(u>>8); out[2]=(unsigned char)(u>>16); out[3]=(unsigned char)(u>>24); out+=4; }
+    void Field(float f) { std::uint32_t u; std::memcpy(&u,&f,4); Field(u); }
+    void Field(int i) { Field((std::uint32_t)i); }
+    void Field(unsigned char c) { *out++=c; }
+    void Field(bool b) { *out++=b?1:0; }
+    template<typename S> void Field(S& s) { BinaryFields(*this,s); }
+};
+
+struct BinaryDecoder {
+    const unsigned char* in;
+    void Field(std::uint32_t& u) { u=(std::uint32_t)in[0] | ((std::uint32_t)in[1]<<8) | ((std::uint32_t)in[2]<<16) | ((std::uint32_t)in[3]<<24); in+=4; }
+    void Field(float& f) { std::uint32_t u; Field(u); std::memcpy(&f,&u,4); }
+    void Field(int& i) { std::uint32_t u; Field(u); i=(int)u; }
+    void Field(unsigned char& c) { c=*in++; }
+    void Field(bool& b) { b=(*in++!=0); }
+    template<typename S> void Field(S& s) { BinaryFields(*this,s); }
+};
+
+template<typename T> constexpr std::size_t BinarySize() {
+    BinarySizer sizer;
+    T value{};
+    BinaryFields(sizer,value);
+return sizer.bytes;
+}
+
+//True when an array of T can be copied to or from the binary layout as is
+template<typename T> constexpr bool BinaryLayoutIsMemory() {
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__==__ORDER_BIG_ENDIAN__)
+return false;
+#else
+return std::is_trivially_copyable<T>::value && sizeof(T)==BinarySize<T>();
+#endif
+}
+
+//Encoding only reads the value's fields; BinaryFields() takes them as non-const so the one list serves both directions
+template<typename T> unsigned char* EncodeBinary(unsigned char* out, const T& value) {
+    BinaryEncoder encoder{out};
+    BinaryFields(encoder,const_cast<T&>(value));
+return encoder.out;
+}
+
+template<typename T> const unsigned char* DecodeBinary(const unsigned char* in, T& value) {
+    value=T{};
+    BinaryDecoder decoder{in};
+    BinaryFields(decoder,value);
+return decoder.in;
+}
+
+template<typename T> unsigned char* EncodeBinary(unsigned char* out, const T* values, std::size_t n) {
+    if constexpr (BinaryLayoutIsMemory<T>()) {
+        if (n>0) std::memcpy(out,values,n*sizeof(T));
+    return out+n*sizeof(T);
+    }
+    else {
+        for (std::size_t i=0; i<n; i++) out=EncodeBinary(out,values[i]);
+    return out;
+    }
+}
+
+template<typename T> const unsigned char* DecodeBinary(const unsigned char* in, T* values, std::size_t n) {
+    if constexpr (BinaryLayoutIsMemory<T>()) {
+        if (n>0) std::memcpy(values,in,n*sizeof(T));
+    return in+n*sizeof(T);
+    }
+    else {
+        for (std::size_t i=0; i<n; i++) in=DecodeBinary(in,values[i]);
+    return in;
+    }
+}
+
+template<typename T> std::ostream& WriteBinary(std::ostream& os, const T& value) {
+    unsigned char buffer[BinarySize<T>()];
+    EncodeBinary(buffer,value);
+return os.write(reinterpret_cast<const char*>(buffer),sizeof(buffer));
+}
+
+template<typename T> std::istream& ReadBinary(std::istream& is, T& value) {
+    unsigned char buffer[BinarySize<T>()];
+    if (is.read(reinterpret_cast<char*>(buffer),sizeof(buffer))) DecodeBinary(buffer,value);
+return is;
+}
+
+//Arrays whose layout differs from memory go through a stack buffer a few kilobytes at a time
+template<typename T> std::ostream& WriteBinary(std::ostream& os, const T* values, std::size_t n) {
+    if constexpr (BinaryLayoutIsMemory<T>()) {
+    return os.write(reinterpret_cast<const char*>(values),(std::streamsize)(n*sizeof(T)));
+    }
+    else {
+        constexpr std::size_t perChunk=(4096/BinarySize<T>()>0)?4096/BinarySize<T>():1;
+        unsigned char buffer[perChunk*BinarySize<T>()];
+        for (std::size_t i=0; i<n && os; i+=perChunk) {
+            std::size_t count=std::min(perChunk,n-i);
+            unsigned char* end=EncodeBinary(buffer,values+i,count);
+            os.write(reinterpret_cast<const char*>(buffer),end-buffer);
+        }
+    return os;
+    }
+}
+
+template<typename T> std::istream& ReadBinary(std::istream& is, T* values, std::size_t n) {
+    if constexpr (BinaryLayoutIsMemory<T>()) {
+    return is.read(reinterpret_cast<char*>(values),(std::streamsize)(n*sizeof(T)));
+    }
+    else {
+        constexpr std::size_t perChunk=(4096/BinarySize<T>()>0)?4096/BinarySize<T>():1;
+        unsigned char buffer[perChunk*BinarySize<T>()];
+        for (std::size_t i=0; i<n; i+=perChunk) {
+            std::size_t count=std::min(perChunk,n-i);
+            if (!is.read(reinterpret_cast<char*>(buffer),(std::streamsize)(count*BinarySize<T>()))) break;
+            DecodeBinary(buffer,values+i,count);
+        }
+    return is;
+    }
+}
+
+template<typename T, typename A> std::ostream& WriteBinary(std::ostream& os, const std::vector<T,A>& values) {
+return WriteBinary(os,values.data(),values.size());
+}
+
+//Reads values.size() values; resize the vector first to the number expected
+template<typename T, typename A> std::istream& ReadBinary(std::istream& is, std::vector<T,A>& values) {
+return ReadBinary(is,values.data(),values.size());
+}
+
+} // namespace RaylibOps
+
+#endif // RAYLIBOPS_INPUT_HPP_INCLUDED
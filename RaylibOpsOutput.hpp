@@ -0,0 +1,625 @@
+#ifndef RAYLIBOPS_OUTPUT_HPP_INCLUDED
+#define RAYLIBOPS_OUTPUT_HPP_INCLUDED
+#include "RaylibOpsPixelFormat.hpp"
+#include <ostream>
+
+// **************************************************************
+//
+//      C++ Operator Overloads for RayLib: output
+//
+// **************************************************************
+//
+// operator<< and FormatTo() for the raylib types, and AsyncLog.  Only declares the streams: include <iostream> where std::cout is used.
+
+// ********************************************
+//
+//           OUTPUT STREAM OVERLOADS
+//
+// ********************************************
+// For use with cout, filestreams, etc.
+// Two different formats are provided for printing vectors and colors.  Use the #define section of RaylibOpsConfig.hpp to select betweem them.
+// Other convenience overloads are provided below which allow for easy printing of components of structs.  Some of these make use of the vector format selected above when Vectors are part of the struct
+
+#include <charconv>
+#include <cstdio>
+#include <cctype>
+#include <cstring>
+#include <string>
+#include <algorithm>
+
+// The overloads format into a char buffer with RaylibOps::TextFormatter, which uses std::to_chars instead of the locale-aware stream machinery, and then write the
+// whole buffer to the stream at once.  The output is byte for byte what inserting each part into the stream would give: the stream's precision, fixed/scientific,
+// showpos, showpoint, uppercase and hex/oct settings are honored (the rarer flags through snprintf).  A field width set with setw() pads the first piece of
+// text, e.g. the "(" of a Vector2, with the stream's fill, left or right as adjustfield says, and is then reset to 0, just as it was by that first insertion.
+//
+// The same formatting is available without any stream or allocation: RaylibOps::FormatTo(buffer,size,value) writes into a char buffer like snprintf, and
+// RaylibOps::FormatTo(str,value) appends to a std::string, allocating only if the string has to grow.  Both use the default float format.
+namespace RaylibOps {
+
+class TextFormatter {
+public:
+    //Default formatting, as on a freshly constructed stream: six significant digits, decimal integers
+    TextFormatter(char* buffer, std::size_t size) : first(buffer), last(buffer+size), cur(buffer), needed(0), lead(0), pieces(0), format(std::chars_format::general), precision(6), base(10), floatSpec(), intSpec(), unsignedSpec() {}
+
+    //Formatting matching the flags and precision of a stream
+    TextFormatter(char* buffer, std::size_t size, const std::ios_base& flags) : TextFormatter(buffer,size) {
+        std::ios_base::fmtflags f=flags.flags();
+        std::ios_base::fmtflags field=f & std::ios_base::floatfield;
+        precision=(int)std::min<std::streamsize>(flags.precision(),256);
+        if (field==std::ios_base::fixed) format=std::chars_format::fixed;
+        if (field==std::ios_base::scientific) format=std::chars_format::scientific;
+        bool upper=(f & std::ios_base::uppercase)!=0;
+        if (field==(std::ios_base::fixed|std::ios_base::scientific) || (f & (std::ios_base::showpos|std::ios_base::showpoint|std::ios_base::uppercase))) {
+            char conversion=(field==std::ios_base::fixed)?'f':(field==std::ios_base::scientific)?'e':(field==(std::ios_base::fixed|std::ios_base::scientific))?'a':'g';
+            char* p=floatSpec;
+            *p++='%';
+            if (f & std::ios_base::showpos) *p++='+';
+            if (f & std::ios_base::showpoint) *p++='#';
+            if (conversion!='a') { *p++='.'; *p++='*'; }
+            *p++=(upper && conversion!='f')?(char)std::toupper(conversion):conversion;  //As in num_put, fixed is %f even with uppercase, i.e. inf not INF
+        }
+        std::ios_base::fmtflags basefield=f & std::ios_base::basefield;
+        base=(basefield==std::ios_base::hex)?16:(basefield==std::ios_base::oct)?8:10;
+        if (base!=10 || (f & (std::ios_base::showpos|std::ios_base::showbase|(upper?std::ios_base::uppercase:std::ios_base::fmtflags(0))))) {
+            char conversion=(base==16)?(upper?'X':'x'):(base==8)?'o':'d';
+            char* p=intSpec;
+            char* q=unsignedSpec;
+            *p++='%';
+            *q++='%';
+            if ((f & std::ios_base::showpos) && base==10) *p++='+';  //showpos never applies to unsigned, nor to hex or octal
+            if (f & std::ios_base::showbase) { *p++='#'; *q++='#'; }
+            *p++=conversion;
+            *q++=(base==10)?'u':conversion;
+        }
+    }
+
+    TextFormatter& operator<<(const char* s) {
+        Append(s,std::strlen(s));
+    return *this;
+    }
+
+    TextFormatter& operator<<(const std::string& s) {
+        Append(s.data(),s.size());
+    return *this;
+    }
+
+    TextFormatter& operator<<(float value) {
+        char digits[320];
+        int n;
+        if (floatSpec[0]) {
+            if (floatSpec[std::strlen(floatSpec)-1]=='a' || floatSpec[std::strlen(floatSpec)-1]=='A') n=std::snprintf(digits,sizeof(digits),floatSpec,(double)value);
+            else n=std::snprintf(digits,sizeof(digits),floatSpec,precision,(double)value);
+        }
+        else {
+            std::to_chars_result r=std::to_chars(digits,digits+sizeof(digits),value,format,precision);
+            n=(r.ec==std::errc())?(int)(r.ptr-digits):0;
+        }
+        Append(digits,(std::size_t)n);
+    return *this;
+    }
+
+    TextFormatter& operator<<(int value) {
+        char digits[40];
+        int n;
+        if (intSpec[0]) n=std::snprintf(digits,sizeof(digits),intSpec,(base==10)?value:(int)(unsigned int)value);
+        else n=(int)(std::to_chars(digits,digits+sizeof(digits),value).ptr-digits);
+        Append(digits,(std::size_t)n);
+    return *this;
+    }
+
+    TextFormatter& operator<<(unsigned int value) {
+        char digits[40];
+        int n;
+        if (unsignedSpec[0]) n=std::snprintf(digits,sizeof(digits),unsignedSpec,value);
+        else n=(int)(std::to_chars(digits,digits+sizeof(digits),value).ptr-digits);
+        Append(digits,(std::size_t)n);
+    return *this;
+    }
+
+    //Any struct with a Format() overload, e.g. out<<camera.position
+    template<typename T> TextFormatter& operator<<(const T& value) {
+        Format(*this,value);
+    return *this;
+    }
+
+    const char* data() const { return first; }
+    std::size_t size() const { return (std::size_t)(cur-first); }  //Characters written to the buffer
+    std::size_t required() const { return needed; }  //Characters the whole output needs, even if the buffer was too small
+    bool truncated() const { return needed>size(); }
+    std::size_t leading() const { return lead; }  //Characters of the first piece appended, which a stream's field width applies to
+
+private:
+    void Append(const char* s, std::size_t n) {
+        std::size_t room=(std::size_t)(last-cur);
+        std::size_t k=(n<room)?n:room;
+        std::memcpy(cur,s,k);
+        cur+=k;
+        needed+=n;
+        if (pieces++==0) lead=n;
+    }
+
+    char* first;
+    char* last;
+    char* cur;
+    std::size_t needed;
+    std::size_t lead;
+    std::size_t pieces;
+    std::chars_format format;
+    int precision;
+    int base;
+    char floatSpec[8];  //printf conversions, only set when the stream flags need them
+    char intSpec[8];
+    char unsignedSpec[8];
+};
+
+#ifdef PRINT_VECTORS_WITH_PARENTHESES
+RAYLIBOPS_INLINE void Format(TextFormatter& out, const Vector2& a) {
+    out<<"("<<a.x<<","<<a.y<<")";
+}
+
+RAYLIBOPS_INLINE void Format(TextFormatter& out, const Vector3& a) {
+    out<<"("<<a.x<<","<<a.y<<","<<a.z<<")";
+}
+
+RAYLIBOPS_INLINE void Format(TextFormatter& out, const Vector4& a) {
+    out<<"("<<a.x<<","<<a.y<<","<<a.z<<","<<a.w<<")";
+}
+
+RAYLIBOPS_INLINE void Format(TextFormatter& out, const Color& c) {
+    out<<"("<<(unsigned int)c.r<<","<<(unsigned int)c.g<<","<<(unsigned int)c.b<<","<<(unsigned int)c.a<<")";
+}
+#endif
+
+#ifdef PRINT_VECTORS_BY_COMPONENT
+RAYLIBOPS_INLINE void Format(TextFormatter& out, const Vector2& a) {
+    out<<"x="<<a.x<<", y="<<a.y;
+}
+
+RAYLIBOPS_INLINE void Format(TextFormatter& out, const Vector3& a) {
+    out<<"x="<<a.x<<", y="<<a.y<<", z="<<a.z;
+}
+
+RAYLIBOPS_INLINE void Format(TextFormatter& out, const Vector4& a) {
+    out<<"x="<<a.x<<", y="<<a.y<<", z="<<a.z<<", w="<<a.w;
+}
+
+RAYLIBOPS_INLINE void Format(TextFormatter& out, const Color& c) {
+    out<<"R="<<(unsigned int)c.r<<" G="<<(unsigned int)c.g<<" B="<<(unsigned int)c.b<<" A="<<(unsigned int)c.a;
+}
+#endif
+
+//Per definition of Matrix in raylib.h as "Matrix type (OpenGL style 4x4 - right handed, column major)"
+RAYLIBOPS_INLINE void Format(TextFormatter& out, const Matrix& m) {
+    out<<" \t"<<m.m0<< "\t"<<m.m4<<" \t"<<m.m8<<" \t"<<m.m12<<"\n";
+    out<<" \t"<<m.m1<< "\t"<<m.m5<<" \t"<<m.m9<<" \t"<<m.m13<<"\n";
+    out<<" \t"<<m.m2<< "\t"<<m.m6<<" \t"<<m.m10<<" \t"<<m.m14<<"\n";
+    out<<" \t"<<m.m3<< "\t"<<m.m7<<" \t"<<m.m11<<" \t"<<m.m15<<"\n";
+}
+
+RAYLIBOPS_INLINE void Format(TextFormatter& out, const Rectangle& r) {
+    out<<"Rectangle corner: ("<<r.x<<","<<r.y<<"), Width="<<r.width<<"Height="<<r.height;
+}
+
+RAYLIBOPS_INLINE void Format(TextFormatter& out, const Image& i) {
+    out<<"Image width="<<i.width<<" Height="<<i.height<<" Mipmap levels="<<i.mipmaps<<" PixelFormat number:"<<i.format<<" type: "<<PixelFormatNumberToName(i.format)<<" ";
+}
+
+RAYLIBOPS_INLINE void Format(TextFormatter& out, const Texture& t) {
+    out<<"Texture ID#: "<<t.id<<" Width="<<t.width<<" Height="<<t.height<<" Mipmap levels="<<t.mipmaps<<" PixelFormat number:"<<t.format<<" type: "<<PixelFormatNumberToName(t.format)<<" ";
+}
+
+//Camera output with its matrix m already computed, e.g. by a CameraSnapshot
+RAYLIBOPS_INLINE void FormatCamera(TextFormatter& out, const Camera2D& c, const Matrix& m) {
+    out<<"** 2D Camera info. **\nOffset: "<<c.offset<<" Target: "<<c.target<<" Rotation: "<<c.rotation<<" Zoom="<<c.zoom;
+    out<<"\nCamera matrix\n"<<m<<"\n";
+}
+
+//Definition of Camera3D in raylib.h states that fovy is field-of-view aperture in perspective mode, but near plane width in orthographic mode
+RAYLIBOPS_INLINE void FormatCamera(TextFormatter& out, const Camera3D& c, const Matrix& m) {
+    out<<"*** 3D Camera info. ***\nPosition: "<<c.position<<" Target: "<<c.target<<" Up vector: "<<c.up<<"\n";
+    if (c.projection==CAMERA_PERSPECTIVE) {
+        out<<"Projection mode: perspective.  FOV="<<c.fovy<<" degrees\n";
+    }
+    if (c.projection==CAMERA_ORTHOGRAPHIC) {
+        out<<"Projection mode: orthographic. Near plane width="<<c.fovy<<"\n";
+    }
+    out<<"Camera matrix:\n"<<m<<"\n";
+}
+
+RAYLIBOPS_INLINE void Format(TextFormatter& out, const Camera2D& c) {
+    FormatCamera(out,c,GetCameraMatrix2D(c));
+}
+
+RAYLIBOPS_INLINE void Format(TextFormatter& out, const Camera3D& c) {
+    FormatCamera(out,c,GetCameraMatrix(c));
+}
+
+RAYLIBOPS_INLINE void Format(TextFormatter& out, const Ray& r) {
+    out<<"Ray position: "<<r.position<<" Ray direction: "<<r.direction;
+}
+
+RAYLIBOPS_INLINE void Format(TextFormatter& out, const RayHitInfo& rhi) {
+    if (rhi.hit) {
+        out<<"Ray hit. Distance="<<rhi.distance<<" Position: "<<rhi.position<<" Surface normal: "<<rhi.normal;
+    }
+    else {
+        out<<"Ray missed.";
+    }
+}
+
+RAYLIBOPS_INLINE void Format(TextFormatter& out, const BoundingBox& bb) {
+    out<<"Bounding box coordinates.  Min: "<<bb.min<<" Max: "<<bb.max;
+}
+
+RAYLIBOPS_INLINE void Format(TextFormatter& out, const NPatchInfo& np) {
+    out<<"NPatch info:  Rectangle: "<<np.source<<" Border offsets: Left: "<<np.left<<" Right: "<<np.right<<" Top: "<<np.top<<" Bottom: "<<np.bottom<<" Layout: "<<np.layout;
+}
+
+RAYLIBOPS_INLINE void Format(TextFormatter& out, const CharInfo& ci) {
+    out<<"Char info:  Char value: "<<ci.value<<" Offset X: "<<ci.offsetX<<" Offset Y: "<<ci.offsetY<<" Advance position X: "<<ci.advanceX;
+}
+
+RAYLIBOPS_INLINE void Format(TextFormatter& out, const Font& f) {
+    out<<"Font info:  Base size (default char height): "<<f.baseSize<<" Number of characters: "<<f.charsCount<<" Padding around chars: "<<f.charsPadding;
+}
+
+//Writes formatted text to the stream, padding its first piece to the stream's field width as inserting that piece would have, then resetting the width
+RAYLIBOPS_INLINE void WriteText(std::ostream& os, const TextFormatter& out) {
+    std::streamsize width=os.width();
+    std::size_t lead=std::min(out.leading(),out.size());
+    if (width<=0 || (std::size_t)width<=lead) {
+        os.write(out.data(),(std::streamsize)out.size());
+        os.width(0);
+    return;
+    }
+    std::size_t pad=(std::size_t)width-lead;
+    char fill=os.fill();
+    std::size_t at=0;
+    if ((os.flags() & std::ios_base::adjustfield)==std::ios_base::left) {
+        os.write(out.data(),(std::streamsize)lead);
+        at=lead;
+    }
+    for (std::size_t i=0; i<pad; i++) os.put(fill);
+    os.write(out.data()+at,(std::streamsize)(out.size()-at));
+    os.width(0);
+}
+
+//Formats value into a local buffer, or a larger one if that is too small, and writes it to the stream in one call
+template<typename T> std::ostream& WriteFormatted(std::ostream& os, const T& value) {
+    char buffer[1024];
+    TextFormatter out(buffer,sizeof(buffer),os);
+    Format(out,value);
+    if (!out.truncated()) {
+        WriteText(os,out);
+    return os;
+    }
+    std::string larger(out.required(),'\0');
+    TextFormatter retry(&larger[0],larger.size(),os);
+    Format(retry,value);
+    WriteText(os,retry);
+return os;
+}
+
+//Like snprintf: writes at most size-1 characters and a terminating 0, and returns the length the whole output needs
+template<typename T> std::size_t FormatTo(char* buffer, std::size_t size, const T& value) {
+    if (size==0) {
+        char none[1];
+        TextFormatter out(none,0);
+        Format(out,value);
+    return out.required();
+    }
+    TextFormatter out(buffer,size-1);
+    Format(out,value);
+    buffer[out.size()]='\0';
+return out.required();
+}
+
+//Appends the formatted value to str
+template<typename T> std::string& FormatTo(std::string& str, const T& value) {
+    char buffer[1024];
+    TextFormatter out(buffer,sizeof(buffer));
+    Format(out,value);
+    if (!out.truncated()) return str.append(out.data(),out.size());
+    std::size_t at=str.size();
+    str.resize(at+out.required());
+    TextFormatter retry(&str[at],out.required());
+    Format(retry,value);
+return str;
+}
+
+} // namespace RaylibOps
+
+RAYLIBOPS_INLINE std::ostream& operator<<(std::ostream& os, const Vector2& v) {
+    RAYLIBOPS_COUNT(PrintVector2);
+return RaylibOps::WriteFormatted(os,v);
+}
+
+RAYLIBOPS_INLINE std::ostream& operator<<(std::ostream& os, const Vector3& v) {
+    RAYLIBOPS_COUNT(PrintVector3);
+return RaylibOps::WriteFormatted(os,v);
+}
+
+RAYLIBOPS_INLINE std::ostream& operator<<(std::ostream& os, const Vector4& v) {
+    RAYLIBOPS_COUNT(PrintVector4);
+return RaylibOps::WriteFormatted(os,v);
+}
+
+RAYLIBOPS_INLINE std::ostream& operator<<(std::ostream& os, const Color& v) {
+    RAYLIBOPS_COUNT(PrintColor);
+return RaylibOps::WriteFormatted(os,v);
+}
+
+RAYLIBOPS_INLINE std::ostream& operator<<(std::ostream& os, const Matrix& v) {
+    RAYLIBOPS_COUNT(PrintMatrix);
+return RaylibOps::WriteFormatted(os,v);
+}
+
+RAYLIBOPS_INLINE std::ostream& operator<<(std::ostream& os, const Rectangle& v) {
+    RAYLIBOPS_COUNT(PrintRectangle);
+return RaylibOps::WriteFormatted(os,v);
+}
+
+RAYLIBOPS_INLINE std::ostream& operator<<(std::ostream& os, const Image& v) {
+    RAYLIBOPS_COUNT(PrintImage);
+return RaylibOps::WriteFormatted(os,v);
+}
+
+RAYLIBOPS_INLINE std::ostream& operator<<(std::ostream& os, const Texture& v) {
+    RAYLIBOPS_COUNT(PrintTexture);
+return RaylibOps::WriteFormatted(os,v);
+}
+
+RAYLIBOPS_INLINE std::ostream& operator<<(std::ostream& os, const Camera2D& v) {
+    RAYLIBOPS_COUNT(PrintCamera2D);
+return RaylibOps::WriteFormatted(os,v);
+}
+
+RAYLIBOPS_INLINE std::ostream& operator<<(std::ostream& os, const Camera3D& v) {
+    RAYLIBOPS_COUNT(PrintCamera3D);
+return RaylibOps::WriteFormatted(os,v);
+}
+
+RAYLIBOPS_INLINE std::ostream& operator<<(std::ostream& os, const Ray& v) {
+    RAYLIBOPS_COUNT(PrintRay);
+return RaylibOps::WriteFormatted(os,v);
+}
+
+RAYLIBOPS_INLINE std::ostream& operator<<(std::ostream& os, const RayHitInfo& v) {
+    RAYLIBOPS_COUNT(PrintRayHitInfo);
+return RaylibOps::WriteFormatted(os,v);
+}
+
+RAYLIBOPS_INLINE std::ostream& operator<<(std::ostream& os, const BoundingBox& v) {
+    RAYLIBOPS_COUNT(PrintBoundingBox);
+return RaylibOps::WriteFormatted(os,v);
+}
+
+RAYLIBOPS_INLINE std::ostream& operator<<(std::ostream& os, const NPatchInfo& v) {
+    RAYLIBOPS_COUNT(PrintNPatchInfo);
+return RaylibOps::WriteFormatted(os,v);
+}
+
+RAYLIBOPS_INLINE std::ostream& operator<<(std::ostream& os, const CharInfo& v) {
+    RAYLIBOPS_COUNT(PrintCharInfo);
+return RaylibOps::WriteFormatted(os,v);
+}
+
+RAYLIBOPS_INLINE std::ostream& operator<<(std::ostream& os, const Font& v) {
+    RAYLIBOPS_COUNT(PrintFont);
+return RaylibOps::WriteFormatted(os,v);
+}
+
+
+// ********************************************
+//
+//           ASYNCHRONOUS LOGGING
+//
+// ********************************************
+// RaylibOps::AsyncLog copies values into a ring buffer on the calling thread and formats them on a thread of its own, so that logging never waits on a stream flush.
+// E.g. RaylibOps::AsyncLog log(telemetryFile); then, once per frame on the render thread, log.Post("camera",camera); log.Post(hitInfo); log.Post("frame done");
+// Each Post() becomes one line, written exactly as operator<< would write the value (label: value), using the format flags of the stream at the time it is written.
+//
+// Any number of threads may Post() at once.  A post claims a slot with one compare-and-swap and never locks or allocates.  The buffer holds capacity records of at most
+// RecordBytes each, which is all the memory the log uses apart from a 64 KB formatting buffer.  When it is full, LogOverflow::Drop discards the new record and counts it
+// in Dropped(), while LogOverflow::Block waits for the writer thread to make room.  Flush() waits until every record posted so far is written; the destructor does too.
+// Records are raw copies, so pointer fields (e.g. Image::data) are kept only as addresses, which is all operator<< prints.  Labels must be string literals or
+// otherwise outlive the log.
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <type_traits>
+#include <vector>
+
+namespace RaylibOps {
+
+enum class LogOverflow { Drop, Block };
+
+class AsyncLog {
+public:
+    static const std::size_t RecordBytes=128;
+
+    explicit AsyncLog(std::ostream& os, std::size_t capacity=4096, LogOverflow overflow=LogOverflow::Drop)
+        : stream(os), slots(RoundUpToPowerOfTwo(capacity)), mask(slots.size()-1), policy(overflow), tail(0), head(0), written(0), dropped(0), stopping(false) {
+        for (std::size_t i=0; i<slots.size(); i++) slots[i].sequence.store(i,std::memory_order_relaxed);
+        writer=std::thread([this] { Drain(); });
+    }
+
+    ~AsyncLog() {
+        stopping.store(true,std::memory_order_release);
+        writer.join();
+    }
+
+    AsyncLog(const AsyncLog&)=delete;
+    AsyncLog& operator=(const AsyncLog&)=delete;
+
+    template<typename T> bool Post(const char* label, const T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "AsyncLog records are raw copies of the value");
+        static_assert(sizeof(T)<=RecordBytes, "Value too large for an AsyncLog record");
+        std::size_t position;
+        Slot* s=Claim(position);
+        if (!s) return false;
+        s->label=label;
+        s->format=&FormatRecord<T>;
+        std::memcpy(s->payload,&value,sizeof(T));
+        s->sequence.store(position+1,std::memory_order_release);
+    return true;
+    }
+
+    template<typename T> bool Post(const T& value) {
+    return Post<T>(nullptr,value);
+    }
+
+    //A line of text only
+    bool Post(const char* message) {
+        std::size_t position;
+        Slot* s=Claim(position);
+        if (!s) return false;
+        s->label=message;
+        s->format=nullptr;
+        s->sequence.store(position+1,std::memory_order_release);
+    return true;
+    }
+
+    void Flush() {
+        std::size_t target=tail.load(std::memory_order_acquire);
+        while (written.load(std::memory_order_acquire)<target) std::this_thread::yield();
+    }
+
+    std::size_t Dropped() const { return dropped.load(std::memory_order_relaxed); }
+    std::size_t Written() const { return written.load(std::memory_order_relaxed); }
+    std::size_t Capacity() const { return slots.size(); }
+
+private:
+    static const std::size_t BatchBytes=65536;
+
+    //A slot is free for the post at position p when its sequence is p, and ready to format when it is p+1 (Vyukov's bounded queue)
+    struct Slot {
+        std::atomic<std::size_t> sequence;
+        const char* label;
+        void (*format)(TextFormatter&, const void*);
+        alignas(16) unsigned char payload[RecordBytes];
+    };
+
+    template<typename T> static void FormatRecord(TextFormatter& out, const void* payload) {
+        T value;
+        std::memcpy(&value,payload,sizeof(T));
+        Format(out,value);
+    }
+
+    static std::size_t RoundUpToPowerOfTwo(std::size_t n) {
+        std::size_t p=1;
+        while (p<n) p*=2;
+    return p;
+    }
+
+    Slot* Claim(std::size_t& position) {
+        std::size_t p=tail.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& s=slots[p & mask];
+            std::size_t sequence=s.sequence.load(std::memory_order_acquire);
+            if (sequence==p) {
+                if (tail.compare_exchange_weak(p,p+1,std::memory_order_relaxed)) {
+                    position=p;
+                return &s;
+                }
+            }
+            else if (sequence<p) {  //Full: the slot still holds the record posted capacity positions ago
+                if (policy==LogOverflow::Drop) {
+                    dropped.fetch_add(1,std::memory_order_relaxed);
+                return nullptr;
+                }
+                std::this_thread::yield();
+                p=tail.load(std::memory_order_relaxed);
+            }
+            else p=tail.load(std::memory_order_relaxed);  //Another thread claimed p first
+        }
+    }
+
+    static void FormatLine(TextFormatter& out, const Slot& s) {
+        if (s.label) out<<s.label;
+        if (s.format) {
+            if (s.label) out<<": ";
+            s.format(out,s.payload);
+        }
+        out<<"\n";
+    }
+
+    //Formats s after the first used characters of batch.  A line which doesn't fit is written out with the batch so far, reusing the buffer, grown if need be.
+    std::size_t Append(std::vector<char>& batch, std::size_t used, const Slot& s) {
+        TextFormatter out(&batch[used],batch.size()-used,stream);
+        FormatLine(out,s);
+        if (!out.truncated()) return used+out.size();
+        stream.write(batch.data(),(std::streamsize)used);
+        if (out.required()>batch.size()) batch.resize(out.required());
+        TextFormatter retry(batch.data(),batch.size(),stream);
+        FormatLine(retry,s);
+    return retry.size();
+    }
+
+    void Drain() {
+        std::vector<char> batch(BatchBytes);
+        for (;;) {
+            bool stop=stopping.load(std::memory_order_acquire);
+            std::size_t used=0, count=0;
+            for (;;) {
+                Slot& s=slots[head & mask];
+                if (s.sequence.load(std::memory_order_acquire)!=head+1) break;
+                used=Append(batch,used,s);
+                s.sequence.store(head+mask+1,std::memory_order_release);  //Free for the post capacity positions later
+                head++;
+                count++;
+                if (count==slots.size()) break;  //Let the stream have a full buffer's worth at a time
+            }
+            if (used>0) {
+                stream.write(batch.data(),(std::streamsize)used);
+                stream.flush();
+            }
+            written.fetch_add(count,std::memory_order_release);
+            if (count==0) {
+                if (stop) return;
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+    }
+
+    std::ostream& stream;
+    std::vector<Slot> slots;
+    std::size_t mask;
+    LogOverflow policy;
+    alignas(64) std::atomic<std::size_t> tail;  //Next position to post, shared by the producers
+    alignas(64) std::size_t head;  //Next position to format, only touched by the writer thread
+    std::atomic<std::size_t> written;
+    std::atomic<std::size_t> dropped;
+    std::atomic<bool> stopping;
+    std::thread writer;
+};
+
+} // namespace RaylibOps
+
+#endif // RAYLIBOPS_OUTPUT_HPP_INCLUDED
+
+//CameraSnapshot and CameraSnapshot2D, once RaylibOpsBatched.hpp is included as well
+#if defined(RAYLIBOPS_BATCHED_HPP_INCLUDED) && !defined(RAYLIBOPS_SNAPSHOT_OUTPUT_INCLUDED)
+#define RAYLIBOPS_SNAPSHOT_OUTPUT_INCLUDED
+namespace RaylibOps {
+
+RAYLIBOPS_INLINE void Format(TextFormatter& out, const CameraSnapshot2D& s) {
+    FormatCamera(out,s.GetCamera(),s.View());
+}
+
+RAYLIBOPS_INLINE void Format(TextFormatter& out, const CameraSnapshot& s) {
+    FormatCamera(out,s.GetCamera(),s.View());
+}
+
+RAYLIBOPS_INLINE std::ostream& operator<<(std::ostream& os, const CameraSnapshot2D& v) {
+    RAYLIBOPS_COUNT(PrintCameraSnapshot2D);
+return WriteFormatted(os,v);
+}
+
+RAYLIBOPS_INLINE std::ostream& operator<<(std::ostream& os, const CameraSnapshot& v) {
+    RAYLIBOPS_COUNT(PrintCameraSnapshot);
+return WriteFormatted(os,v);
+}
+
+} // namespace RaylibOps
+#endif
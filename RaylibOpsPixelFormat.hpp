@@ -0,0 +1,91 @@
+#ifndef RAYLIBOPS_PIXELFORMAT_HPP_INCLUDED
+#define RAYLIBOPS_PIXELFORMAT_HPP_INCLUDED
+#include "RaylibOpsConfig.hpp"
+
+// **************************************************************
+//
+//      C++ Operator Overloads for RayLib: pixel formats
+//
+// **************************************************************
+//
+// The PixelFormat table shared by the Image operators and the output of Images and Textures.
+
+// PixelFormat table
+//
+// One entry per PixelFormat enum value in raylib.h, indexed by the value itself, with the enum name and comment plus the layout facts needed to size pixel data.
+// Entry 0 stands for any unrecognized number.  For compressed formats pixels are stored in blocks of blockWidth x blockHeight pixels taking blockBytes each;
+// uncompressed formats count as 1x1 blocks of bitsPerPixel/8 bytes.  Everything is constexpr, so lookups compile to an index and no strings are built.
+namespace RaylibOps {
+
+struct PixelFormatInfo {
+    int format;
+    const char* name;
+    int bitsPerPixel;
+    int channels;
+    bool compressed;
+    int blockWidth;
+    int blockHeight;
+    int blockBytes;
+};
+
+constexpr PixelFormatInfo PixelFormats[]={
+    { 0, "Unrecognized PixelFormat number", 0, 0, false, 1, 1, 0 },
+    { PIXELFORMAT_UNCOMPRESSED_GRAYSCALE, "PIXELFORMAT_UNCOMPRESSED_GRAYSCALE, 8 bit per pixel (no alpha)", 8, 1, false, 1, 1, 1 },
+    { PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA, "PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA, 8*2 bpp (2 channels)", 16, 2, false, 1, 1, 2 },
+    { PIXELFORMAT_UNCOMPRESSED_R5G6B5, "PIXELFORMAT_UNCOMPRESSED_R5G6B5, 16 bpp", 16, 3, false, 1, 1, 2 },
+    { PIXELFORMAT_UNCOMPRESSED_R8G8B8, "PIXELFORMAT_UNCOMPRESSED_R8G8B8, 24 bpp", 24, 3, false, 1, 1, 3 },
+    { PIXELFORMAT_UNCOMPRESSED_R5G5B5A1, "PIXELFORMAT_UNCOMPRESSED_R5G5B5A1, 16 bpp (1 bit alpha)", 16, 4, false, 1, 1, 2 },
+    { PIXELFORMAT_UNCOMPRESSED_R4G4B4A4, "PIXELFORMAT_UNCOMPRESSED_R4G4B4A4, 16 bpp (4 bit alpha)", 16, 4, false, 1, 1, 2 },
+    { PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, "PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 32 bpp", 32, 4, false, 1, 1, 4 },
+    { PIXELFORMAT_UNCOMPRESSED_R32, "PIXELFORMAT_UNCOMPRESSED_R32, 32 bpp (1 channel - float)", 32, 1, false, 1, 1, 4 },
+    { PIXELFORMAT_UNCOMPRESSED_R32G32B32, "PIXELFORMAT_UNCOMPRESSED_R32G32B32, 32*3 bpp (3 channels - float)", 96, 3, false, 1, 1, 12 },
+    { PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, "PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, 32*4 bpp (4 channels - float)", 128, 4, false, 1, 1, 16 },
+    { PIXELFORMAT_COMPRESSED_DXT1_RGB, "PIXELFORMAT_COMPRESSED_DXT1_RGB, 4 bpp (no alpha)", 4, 3, true, 4, 4, 8 },
+    { PIXELFORMAT_COMPRESSED_DXT1_RGBA, "PIXELFORMAT_COMPRESSED_DXT1_RGBA, 4 bpp (1 bit alpha)", 4, 4, true, 4, 4, 8 },
+    { PIXELFORMAT_COMPRESSED_DXT3_RGBA, "PIXELFORMAT_COMPRESSED_DXT3_RGBA, 8 bpp", 8, 4, true, 4, 4, 16 },
+    { PIXELFORMAT_COMPRESSED_DXT5_RGBA, "PIXELFORMAT_COMPRESSED_DXT5_RGBA, 8 bpp", 8, 4, true, 4, 4, 16 },
+    { PIXELFORMAT_COMPRESSED_ETC1_RGB, "PIXELFORMAT_COMPRESSED_ETC1_RGB, 4 bpp", 4, 3, true, 4, 4, 8 },
+    { PIXELFORMAT_COMPRESSED_ETC2_RGB, "PIXELFORMAT_COMPRESSED_ETC2_RGB, 4 bpp", 4, 3, true, 4, 4, 8 },
+    { PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA, "PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA, 8 bpp", 8, 4, true, 4, 4, 16 },
+    { PIXELFORMAT_COMPRESSED_PVRT_RGB, "PIXELFORMAT_COMPRESSED_PVRT_RGB, 4 bpp", 4, 3, true, 4, 4, 8 },
+    { PIXELFORMAT_COMPRESSED_PVRT_RGBA, "PIXELFORMAT_COMPRESSED_PVRT_RGBA, 4 bpp", 4, 4, true, 4, 4, 8 },
+    { PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA, "PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA, 8 bpp", 8, 4, true, 4, 4, 16 },
+    { PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA, "PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA, 2 bpp", 2, 4, true, 8, 8, 16 }
+};
+
+constexpr int PixelFormatCount=(int)(sizeof(PixelFormats)/sizeof(PixelFormats[0]));
+
+//The table relies on the enum running 1, 2, 3... in this order; check every entry at compile time
+constexpr bool PixelFormatsIndexedByValue(int i=1) { return (i==PixelFormatCount) || (PixelFormats[i].format==i && PixelFormatsIndexedByValue(i+1)); }
+static_assert(PixelFormatsIndexedByValue(),"PixelFormats[] must be indexed by PixelFormat value");
+
+RAYLIBOPS_CONSTEXPR const PixelFormatInfo& PixelFormatLookup(int format) {
+return PixelFormats[(format>0 && format<PixelFormatCount)?format:0];
+}
+
+//Bytes of pixel data for one width x height level.  Compressed formats round up to whole blocks.
+RAYLIBOPS_CONSTEXPR std::size_t PixelDataSize(int width, int height, int format) {
+    const PixelFormatInfo& f=PixelFormatLookup(format);
+return (std::size_t)((width+f.blockWidth-1)/f.blockWidth) * (std::size_t)((height+f.blockHeight-1)/f.blockHeight) * (std::size_t)f.blockBytes;
+}
+
+//Bytes of pixel data for an Image including all its mipmap levels, each half the size of the previous one
+RAYLIBOPS_CONSTEXPR std::size_t ImageDataSize(const Image& image) {
+    std::size_t total=0;
+    int w=image.width, h=image.height;
+    for (int level=0; level<image.mipmaps; level++) {
+        total+=PixelDataSize(w,h,image.format);
+        w=(w>1)?w/2:1;
+        h=(h>1)?h/2:1;
+    }
+return total;
+}
+
+} // namespace RaylibOps
+
+//Enum is found in raylib.h.  This merely "reverses" it.
+RAYLIBOPS_CONSTEXPR const char* PixelFormatNumberToName(int format) {
+return RaylibOps::PixelFormatLookup(format).name;
+}
+
+#endif // RAYLIBOPS_PIXELFORMAT_HPP_INCLUDED
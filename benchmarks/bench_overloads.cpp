@@ -0,0 +1,447 @@
+// **************************************************************
+//
+//      C++ Operator Overloads for RayLib: benchmarks
+//
+// **************************************************************
+//
+// Times each Vector2, Vector3, Vector4, Matrix and Color arithmetic overload, compound assignments included, against the raymath call it wraps (or, where
+// raymath has none, the same arithmetic written out), and the operator<< of each raylib struct against snprintf of the same text, which is printf without
+// the terminal.  The integer vector, Rectangle, BoundingBox and Quat operators are not timed.  Every benchmark runs over batches of 16 to 2^20 operands, so
+// the rows show both the per-call cost of the wrapper layer and, for the large batches, memory bandwidth.  CMakeLists.txt builds this file once per
+// EQUALITY_OPERATOR_ mode.
+// Rows are named Type/operation/implementation/batch, e.g. Vector3/add/operator/1024 and Vector3/add/raymath/1024.
+#include "RaylibOpsArithmetic.hpp"
+#include "RaylibOpsEquality.hpp"
+#include "RaylibOpsOutput.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+const std::vector<long long> BatchSizes={16, 1024, 65536, 1<<20};
+const std::vector<long long> MatrixBatchSizes={16, 1024, 65536};  //2^20 Matrix operands would be 192MB of arrays
+const std::vector<long long> PrintBatchSizes={16, 1024};
+
+typedef unsigned char Flag;  //The result type of the equality rows, since std::vector<bool> packs bits
+
+//Fills any all-float raylib struct with values in [-100,100]
+template<typename T> void Fill(T& t, std::mt19937& rng) {
+    static_assert(sizeof(T)%sizeof(float)==0, "Fill() takes structs of floats");
+    std::uniform_real_distribution<float> d(-100.0f,100.0f);
+    float f[sizeof(T)/sizeof(float)];
+    for (float& x : f) x=d(rng);
+    std::memcpy(&t,f,sizeof(T));
+}
+
+void Fill(Color& c, std::mt19937& rng) {
+    std::uniform_int_distribution<int> d(0,255);
+    c=Color{(unsigned char)d(rng), (unsigned char)d(rng), (unsigned char)d(rng), (unsigned char)d(rng)};
+}
+
+//Sizes, counts and enum values in their usual ranges, and no pixel data or glyphs, which no printer reads
+int Int(std::mt19937& rng, int low, int high) { return std::uniform_int_distribution<int>(low,high)(rng); }
+
+void Fill(Image& i, std::mt19937& rng) { i=Image{nullptr, Int(rng,1,4096), Int(rng,1,4096), Int(rng,1,13), Int(rng,1,21)}; }
+void Fill(Texture& t, std::mt19937& rng) { t=Texture{(unsigned int)Int(rng,1,1000), Int(rng,1,4096), Int(rng,1,4096), Int(rng,1,13), Int(rng,1,21)}; }
+
+void Fill(Camera3D& c, std::mt19937& rng) {
+    Fill(c.position,rng);
+    Fill(c.target,rng);
+    Fill(c.up,rng);
+    c.fovy=(float)Int(rng,10,120);
+    c.projection=Int(rng,CAMERA_PERSPECTIVE,CAMERA_ORTHOGRAPHIC);
+}
+
+void Fill(RayHitInfo& h, std::mt19937& rng) {
+    h.hit=Int(rng,0,1)!=0;
+    Fill(h.distance,rng);
+    Fill(h.position,rng);
+    Fill(h.normal,rng);
+}
+
+void Fill(NPatchInfo& n, std::mt19937& rng) {
+    Fill(n.source,rng);
+    n=NPatchInfo{n.source, Int(rng,0,64), Int(rng,0,64), Int(rng,0,64), Int(rng,0,64), Int(rng,0,2)};
+}
+
+void Fill(CharInfo& c, std::mt19937& rng) {
+    Fill(c.image,rng);
+    c=CharInfo{Int(rng,32,0x10FFFF), Int(rng,-8,8), Int(rng,-8,8), Int(rng,0,64), c.image};
+}
+
+void Fill(Font& f, std::mt19937& rng) {
+    Fill(f.texture,rng);
+    f=Font{Int(rng,8,96), Int(rng,1,512), Int(rng,0,8), f.texture, nullptr, nullptr};
+}
+
+//The same operands for every benchmark of a type, so the rows compare like with like
+template<typename T> std::vector<T> Operands(std::size_t n, unsigned int seed) {
+    std::mt19937 rng(seed);
+    std::vector<T> v(n);
+    for (T& t : v) Fill(t,rng);
+return v;
+}
+
+//out[i]=op(a[i],b[i]) over the batch
+template<typename A, typename B, typename R, typename Op> void Binary(benchmark::State& state, std::vector<B> (*operands)(std::size_t), Op op) {
+    std::size_t n=(std::size_t)state.range(0);
+    std::vector<A> a=Operands<A>(n,1);
+    std::vector<B> b=operands(n);
+    std::vector<R> out(n);
+    for (auto _ : state) {
+        for (std::size_t i=0; i<n; i++) out[i]=op(a[i],b[i]);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed((long long)state.iterations()*(long long)n);
+}
+
+//out[i]=op(a[i]) over the batch
+template<typename A, typename R, typename Op> void Unary(benchmark::State& state, Op op) {
+    std::size_t n=(std::size_t)state.range(0);
+    std::vector<A> a=Operands<A>(n,1);
+    std::vector<R> out(n);
+    for (auto _ : state) {
+        for (std::size_t i=0; i<n; i++) out[i]=op(a[i]);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed((long long)state.iterations()*(long long)n);
+}
+
+template<typename T> std::vector<T> SameType(std::size_t n) { return Operands<T>(n,2); }
+
+//Scalars in [1,100], so that none divides by zero
+std::vector<float> Scalars(std::size_t n) {
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> d(1.0f,100.0f);
+    std::vector<float> s(n);
+    for (float& x : s) x=d(rng);
+return s;
+}
+
+//Half the pairs equal, half one float apart, so the equality test cannot predict its branches
+template<typename V> std::vector<V> NearlySame(std::size_t n) {
+    std::vector<V> v=Operands<V>(n,1);
+    for (std::size_t i=1; i<n; i+=2) {
+        float* x=reinterpret_cast<float*>(&v[i]);
+        *x=std::nextafter(*x,1e9f);
+    }
+return v;
+}
+
+//The text of one value, written to a string stream, by the buffered FormatTo(), or by snprintf
+template<typename T, typename Print> void Text(benchmark::State& state, Print print) {
+    std::size_t n=(std::size_t)state.range(0);
+    std::vector<T> v=Operands<T>(n,1);
+    std::size_t bytes=0;
+    for (auto _ : state) {
+        for (std::size_t i=0; i<n; i++) bytes+=print(v[i]);
+    }
+    benchmark::DoNotOptimize(bytes);
+    state.SetItemsProcessed((long long)state.iterations()*(long long)n);
+}
+
+std::ostringstream& Stream() {
+    static std::ostringstream os;
+    os.seekp(0);
+return os;
+}
+
+char Buffer[2048];
+
+template<typename T> std::size_t StreamText(const T& v) {
+    std::ostringstream& os=Stream();
+    os<<v;
+return (std::size_t)os.tellp();
+}
+
+template<typename T> std::size_t FormatText(const T& v) {
+return RaylibOps::FormatTo(Buffer,sizeof(Buffer),v);
+}
+
+std::size_t PrintfText(const Vector2& v) { return (std::size_t)std::snprintf(Buffer,sizeof(Buffer),"(%g,%g)",v.x,v.y); }
+std::size_t PrintfText(const Vector3& v) { return (std::size_t)std::snprintf(Buffer,sizeof(Buffer),"(%g,%g,%g)",v.x,v.y,v.z); }
+std::size_t PrintfText(const Vector4& v) { return (std::size_t)std::snprintf(Buffer,sizeof(Buffer),"(%g,%g,%g,%g)",v.x,v.y,v.z,v.w); }
+std::size_t PrintfText(const Color& c) { return (std::size_t)std::snprintf(Buffer,sizeof(Buffer),"(%u,%u,%u,%u)",c.r,c.g,c.b,c.a); }
+//A Matrix printed into text, which the camera printers append to what they wrote before it
+std::size_t PrintfMatrix(char* text, std::size_t size, const Matrix& m) {
+return (std::size_t)std::snprintf(text,size," \t%g\t%g \t%g \t%g\n \t%g\t%g \t%g \t%g\n \t%g\t%g \t%g \t%g\n \t%g\t%g \t%g \t%g\n",
+                                  m.m0,m.m4,m.m8,m.m12, m.m1,m.m5,m.m9,m.m13, m.m2,m.m6,m.m10,m.m14, m.m3,m.m7,m.m11,m.m15);
+}
+std::size_t PrintfText(const Matrix& m) { return PrintfMatrix(Buffer,sizeof(Buffer),m); }
+std::size_t PrintfText(const Rectangle& r) { return (std::size_t)std::snprintf(Buffer,sizeof(Buffer),"Rectangle corner: (%g,%g), Width=%gHeight=%g",r.x,r.y,r.width,r.height); }
+std::size_t PrintfText(const Image& i) {
+return (std::size_t)std::snprintf(Buffer,sizeof(Buffer),"Image width=%d Height=%d Mipmap levels=%d PixelFormat number:%d type: %s ",i.width,i.height,i.mipmaps,i.format,PixelFormatNumberToName(i.format));
+}
+std::size_t PrintfText(const Texture& t) {
+return (std::size_t)std::snprintf(Buffer,sizeof(Buffer),"Texture ID#: %u Width=%d Height=%d Mipmap levels=%d PixelFormat number:%d type: %s ",t.id,t.width,t.height,t.mipmaps,t.format,PixelFormatNumberToName(t.format));
+}
+std::size_t PrintfText(const Camera2D& c) {
+    std::size_t n=(std::size_t)std::snprintf(Buffer,sizeof(Buffer),"** 2D Camera info. **\nOffset: (%g,%g) Target: (%g,%g) Rotation: %g Zoom=%g\nCamera matrix\n",
+                                             c.offset.x,c.offset.y,c.target.x,c.target.y,c.rotation,c.zoom);
+    n+=PrintfMatrix(Buffer+n,sizeof(Buffer)-n,GetCameraMatrix2D(c));
+return n+(std::size_t)std::snprintf(Buffer+n,sizeof(Buffer)-n,"\n");
+}
+std::size_t PrintfText(const Camera3D& c) {
+    std::size_t n=(std::size_t)std::snprintf(Buffer,sizeof(Buffer),"*** 3D Camera info. ***\nPosition: (%g,%g,%g) Target: (%g,%g,%g) Up vector: (%g,%g,%g)\n",
+                                             c.position.x,c.position.y,c.position.z,c.target.x,c.target.y,c.target.z,c.up.x,c.up.y,c.up.z);
+    if (c.projection==CAMERA_PERSPECTIVE) n+=(std::size_t)std::snprintf(Buffer+n,sizeof(Buffer)-n,"Projection mode: perspective.  FOV=%g degrees\n",c.fovy);
+    if (c.projection==CAMERA_ORTHOGRAPHIC) n+=(std::size_t)std::snprintf(Buffer+n,sizeof(Buffer)-n,"Projection mode: orthographic. Near plane width=%g\n",c.fovy);
+    n+=(std::size_t)std::snprintf(Buffer+n,sizeof(Buffer)-n,"Camera matrix:\n");
+    n+=PrintfMatrix(Buffer+n,sizeof(Buffer)-n,GetCameraMatrix(c));
+return n+(std::size_t)std::snprintf(Buffer+n,sizeof(Buffer)-n,"\n");
+}
+std::size_t PrintfText(const Ray& r) {
+return (std::size_t)std::snprintf(Buffer,sizeof(Buffer),"Ray position: (%g,%g,%g) Ray direction: (%g,%g,%g)",r.position.x,r.position.y,r.position.z,r.direction.x,r.direction.y,r.direction.z);
+}
+std::size_t PrintfText(const RayHitInfo& h) {
+    if (!h.hit) return (std::size_t)std::snprintf(Buffer,sizeof(Buffer),"Ray missed.");
+return (std::size_t)std::snprintf(Buffer,sizeof(Buffer),"Ray hit. Distance=%g Position: (%g,%g,%g) Surface normal: (%g,%g,%g)",
+                                  h.distance,h.position.x,h.position.y,h.position.z,h.normal.x,h.normal.y,h.normal.z);
+}
+std::size_t PrintfText(const BoundingBox& b) {
+return (std::size_t)std::snprintf(Buffer,sizeof(Buffer),"Bounding box coordinates.  Min: (%g,%g,%g) Max: (%g,%g,%g)",b.min.x,b.min.y,b.min.z,b.max.x,b.max.y,b.max.z);
+}
+std::size_t PrintfText(const NPatchInfo& p) {
+return (std::size_t)std::snprintf(Buffer,sizeof(Buffer),"NPatch info:  Rectangle: Rectangle corner: (%g,%g), Width=%gHeight=%g Border offsets: Left: %d Right: %d Top: %d Bottom: %d Layout: %d",
+                                  p.source.x,p.source.y,p.source.width,p.source.height,p.left,p.right,p.top,p.bottom,p.layout);
+}
+std::size_t PrintfText(const CharInfo& c) {
+return (std::size_t)std::snprintf(Buffer,sizeof(Buffer),"Char info:  Char value: %d Offset X: %d Offset Y: %d Advance position X: %d",c.value,c.offsetX,c.offsetY,c.advanceX);
+}
+std::size_t PrintfText(const Font& f) {
+return (std::size_t)std::snprintf(Buffer,sizeof(Buffer),"Font info:  Base size (default char height): %d Number of characters: %d Padding around chars: %d",f.baseSize,f.charsCount,f.charsPadding);
+}
+
+//raymath's saturating 0-255 arithmetic has no Color functions, so the baselines are the channel formulas the overloads replaced
+unsigned char Saturate(int x) { return (unsigned char)((x>255)?255:(x<0)?0:x); }
+unsigned char Saturate(float x) { return (unsigned char)((x>255.0f)?255.0f:(x<0.0f)?0.0f:x); }
+
+void Sizes(benchmark::internal::Benchmark* b, const std::vector<long long>& sizes) {
+    for (long long n : sizes) b->Arg(n);
+}
+
+template<typename A, typename B, typename R, typename Op> void AddBinary(const std::string& name, std::vector<B> (*operands)(std::size_t), Op op, const std::vector<long long>& sizes=BatchSizes) {
+    Sizes(benchmark::RegisterBenchmark(name.c_str(),Binary<A,B,R,Op>,operands,op),sizes);
+}
+
+template<typename A, typename R, typename Op> void AddUnary(const std::string& name, Op op, const std::vector<long long>& sizes=BatchSizes) {
+    Sizes(benchmark::RegisterBenchmark(name.c_str(),Unary<A,R,Op>,op),sizes);
+}
+
+template<typename T, typename Print> void AddText(const std::string& name, Print print) {
+    Sizes(benchmark::RegisterBenchmark(name.c_str(),Text<T,Print>,print),PrintBatchSizes);
+}
+
+void RegisterVector2() {
+    AddBinary<Vector2,Vector2,Vector2>("Vector2/add/operator",SameType<Vector2>,[](const Vector2& a, const Vector2& b) { return Vector2(a+b); });
+    AddBinary<Vector2,Vector2,Vector2>("Vector2/add/raymath",SameType<Vector2>,[](const Vector2& a, const Vector2& b) { return Vector2Add(a,b); });
+    AddBinary<Vector2,Vector2,Vector2>("Vector2/subtract/operator",SameType<Vector2>,[](const Vector2& a, const Vector2& b) { return Vector2(a-b); });
+    AddBinary<Vector2,Vector2,Vector2>("Vector2/subtract/raymath",SameType<Vector2>,[](const Vector2& a, const Vector2& b) { return Vector2Subtract(a,b); });
+    AddBinary<Vector2,float,Vector2>("Vector2/scale/operator",Scalars,[](const Vector2& a, float s) { return Vector2(a*s); });
+    AddBinary<Vector2,float,Vector2>("Vector2/scale/raymath",Scalars,[](const Vector2& a, float s) { return Vector2Scale(a,s); });
+    AddBinary<Vector2,float,Vector2>("Vector2/divide/operator",Scalars,[](const Vector2& a, float s) { return Vector2(a/s); });
+    AddBinary<Vector2,float,Vector2>("Vector2/divide/raymath",Scalars,[](const Vector2& a, float s) { return Vector2Scale(a,1.0f/s); });
+    AddUnary<Vector2,Vector2>("Vector2/negate/operator",[](const Vector2& a) { return Vector2(-a); });
+    AddUnary<Vector2,Vector2>("Vector2/negate/raymath",[](const Vector2& a) { return Vector2Negate(a); });
+    AddBinary<Vector2,Vector2,Vector2>("Vector2/add_assign/operator",SameType<Vector2>,[](const Vector2& a, const Vector2& b) { Vector2 r=a; r+=b; return r; });
+    AddBinary<Vector2,Vector2,Vector2>("Vector2/add_assign/raymath",SameType<Vector2>,[](const Vector2& a, const Vector2& b) { return Vector2Add(a,b); });
+    AddBinary<Vector2,Vector2,Vector2>("Vector2/subtract_assign/operator",SameType<Vector2>,[](const Vector2& a, const Vector2& b) { Vector2 r=a; r-=b; return r; });
+    AddBinary<Vector2,Vector2,Vector2>("Vector2/subtract_assign/raymath",SameType<Vector2>,[](const Vector2& a, const Vector2& b) { return Vector2Subtract(a,b); });
+    AddBinary<Vector2,float,Vector2>("Vector2/scale_assign/operator",Scalars,[](const Vector2& a, float s) { Vector2 r=a; r*=s; return r; });
+    AddBinary<Vector2,float,Vector2>("Vector2/scale_assign/raymath",Scalars,[](const Vector2& a, float s) { return Vector2Scale(a,s); });
+    AddBinary<Vector2,float,Vector2>("Vector2/divide_assign/operator",Scalars,[](const Vector2& a, float s) { Vector2 r=a; r/=s; return r; });
+    AddBinary<Vector2,float,Vector2>("Vector2/divide_assign/raymath",Scalars,[](const Vector2& a, float s) { return Vector2Scale(a,1.0f/s); });
+    AddBinary<Vector2,Vector2,Flag>("Vector2/equal/operator",NearlySame<Vector2>,[](const Vector2& a, const Vector2& b) { return a==b; });
+    AddBinary<Vector2,Vector2,Flag>("Vector2/equal/exact",NearlySame<Vector2>,[](const Vector2& a, const Vector2& b) { return a.x==b.x && a.y==b.y; });
+}
+
+void RegisterVector3() {
+    AddBinary<Vector3,Vector3,Vector3>("Vector3/add/operator",SameType<Vector3>,[](const Vector3& a, const Vector3& b) { return Vector3(a+b); });
+    AddBinary<Vector3,Vector3,Vector3>("Vector3/add/raymath",SameType<Vector3>,[](const Vector3& a, const Vector3& b) { return Vector3Add(a,b); });
+    AddBinary<Vector3,Vector3,Vector3>("Vector3/subtract/operator",SameType<Vector3>,[](const Vector3& a, const Vector3& b) { return Vector3(a-b); });
+    AddBinary<Vector3,Vector3,Vector3>("Vector3/subtract/raymath",SameType<Vector3>,[](const Vector3& a, const Vector3& b) { return Vector3Subtract(a,b); });
+    AddBinary<Vector3,float,Vector3>("Vector3/scale/operator",Scalars,[](const Vector3& a, float s) { return Vector3(a*s); });
+    AddBinary<Vector3,float,Vector3>("Vector3/scale/raymath",Scalars,[](const Vector3& a, float s) { return Vector3Scale(a,s); });
+    AddBinary<Vector3,float,Vector3>("Vector3/divide/operator",Scalars,[](const Vector3& a, float s) { return Vector3(a/s); });
+    AddBinary<Vector3,float,Vector3>("Vector3/divide/raymath",Scalars,[](const Vector3& a, float s) { return Vector3Scale(a,1.0f/s); });
+    AddUnary<Vector3,Vector3>("Vector3/negate/operator",[](const Vector3& a) { return Vector3(-a); });
+    AddUnary<Vector3,Vector3>("Vector3/negate/raymath",[](const Vector3& a) { return Vector3Negate(a); });
+    AddBinary<Vector3,Vector3,Vector3>("Vector3/add_assign/operator",SameType<Vector3>,[](const Vector3& a, const Vector3& b) { Vector3 r=a; r+=b; return r; });
+    AddBinary<Vector3,Vector3,Vector3>("Vector3/add_assign/raymath",SameType<Vector3>,[](const Vector3& a, const Vector3& b) { return Vector3Add(a,b); });
+    AddBinary<Vector3,Vector3,Vector3>("Vector3/subtract_assign/operator",SameType<Vector3>,[](const Vector3& a, const Vector3& b) { Vector3 r=a; r-=b; return r; });
+    AddBinary<Vector3,Vector3,Vector3>("Vector3/subtract_assign/raymath",SameType<Vector3>,[](const Vector3& a, const Vector3& b) { return Vector3Subtract(a,b); });
+    AddBinary<Vector3,float,Vector3>("Vector3/scale_assign/operator",Scalars,[](const Vector3& a, float s) { Vector3 r=a; r*=s; return r; });
+    AddBinary<Vector3,float,Vector3>("Vector3/scale_assign/raymath",Scalars,[](const Vector3& a, float s) { return Vector3Scale(a,s); });
+    AddBinary<Vector3,float,Vector3>("Vector3/divide_assign/operator",Scalars,[](const Vector3& a, float s) { Vector3 r=a; r/=s; return r; });
+    AddBinary<Vector3,float,Vector3>("Vector3/divide_assign/raymath",Scalars,[](const Vector3& a, float s) { return Vector3Scale(a,1.0f/s); });
+    AddBinary<Vector3,Vector3,Flag>("Vector3/equal/operator",NearlySame<Vector3>,[](const Vector3& a, const Vector3& b) { return a==b; });
+    AddBinary<Vector3,Vector3,Flag>("Vector3/equal/exact",NearlySame<Vector3>,[](const Vector3& a, const Vector3& b) { return a.x==b.x && a.y==b.y && a.z==b.z; });
+    //The expression a*s+b, which VECTOR_EXPRESSION_TEMPLATES evaluates in one pass and raymath as two calls
+    AddBinary<Vector3,Vector3,Vector3>("Vector3/scale_add/operator",SameType<Vector3>,[](const Vector3& a, const Vector3& b) { return Vector3(a*2.0f+b); });
+    AddBinary<Vector3,Vector3,Vector3>("Vector3/scale_add/raymath",SameType<Vector3>,[](const Vector3& a, const Vector3& b) { return Vector3Add(Vector3Scale(a,2.0f),b); });
+}
+
+void RegisterVector4() {
+    AddBinary<Vector4,Vector4,Vector4>("Vector4/add/operator",SameType<Vector4>,[](const Vector4& a, const Vector4& b) { return Vector4(a+b); });
+    AddBinary<Vector4,Vector4,Vector4>("Vector4/add/written_out",SameType<Vector4>,[](const Vector4& a, const Vector4& b) { return Vector4{a.x+b.x, a.y+b.y, a.z+b.z, a.w+b.w}; });
+    AddBinary<Vector4,Vector4,Vector4>("Vector4/subtract/operator",SameType<Vector4>,[](const Vector4& a, const Vector4& b) { return Vector4(a-b); });
+    AddBinary<Vector4,Vector4,Vector4>("Vector4/subtract/written_out",SameType<Vector4>,[](const Vector4& a, const Vector4& b) { return Vector4{a.x-b.x, a.y-b.y, a.z-b.z, a.w-b.w}; });
+    AddBinary<Vector4,float,Vector4>("Vector4/scale/operator",Scalars,[](const Vector4& a, float s) { return Vector4(a*s); });
+    AddBinary<Vector4,float,Vector4>("Vector4/scale/written_out",Scalars,[](const Vector4& a, float s) { return Vector4{a.x*s, a.y*s, a.z*s, a.w*s}; });
+    AddBinary<Vector4,float,Vector4>("Vector4/divide/operator",Scalars,[](const Vector4& a, float s) { return Vector4(a/s); });
+    AddBinary<Vector4,float,Vector4>("Vector4/divide/written_out",Scalars,[](const Vector4& a, float s) { return Vector4{a.x*(1.0f/s), a.y*(1.0f/s), a.z*(1.0f/s), a.w*(1.0f/s)}; });
+    AddUnary<Vector4,Vector4>("Vector4/negate/operator",[](const Vector4& a) { return Vector4(-a); });
+    AddUnary<Vector4,Vector4>("Vector4/negate/written_out",[](const Vector4& a) { return Vector4{-a.x, -a.y, -a.z, -a.w}; });
+    AddBinary<Vector4,Vector4,Vector4>("Vector4/add_assign/operator",SameType<Vector4>,[](const Vector4& a, const Vector4& b) { Vector4 r=a; r+=b; return r; });
+    AddBinary<Vector4,Vector4,Vector4>("Vector4/add_assign/written_out",SameType<Vector4>,[](const Vector4& a, const Vector4& b) { return Vector4{a.x+b.x, a.y+b.y, a.z+b.z, a.w+b.w}; });
+    AddBinary<Vector4,Vector4,Vector4>("Vector4/subtract_assign/operator",SameType<Vector4>,[](const Vector4& a, const Vector4& b) { Vector4 r=a; r-=b; return r; });
+    AddBinary<Vector4,Vector4,Vector4>("Vector4/subtract_assign/written_out",SameType<Vector4>,[](const Vector4& a, const Vector4& b) { return Vector4{a.x-b.x, a.y-b.y, a.z-b.z, a.w-b.w}; });
+    AddBinary<Vector4,float,Vector4>("Vector4/scale_assign/operator",Scalars,[](const Vector4& a, float s) { Vector4 r=a; r*=s; return r; });
+    AddBinary<Vector4,float,Vector4>("Vector4/scale_assign/written_out",Scalars,[](const Vector4& a, float s) { return Vector4{a.x*s, a.y*s, a.z*s, a.w*s}; });
+    AddBinary<Vector4,float,Vector4>("Vector4/divide_assign/operator",Scalars,[](const Vector4& a, float s) { Vector4 r=a; r/=s; return r; });
+    AddBinary<Vector4,float,Vector4>("Vector4/divide_assign/written_out",Scalars,[](const Vector4& a, float s) { return Vector4{a.x*(1.0f/s), a.y*(1.0f/s), a.z*(1.0f/s), a.w*(1.0f/s)}; });
+    AddBinary<Vector4,Vector4,Flag>("Vector4/equal/operator",NearlySame<Vector4>,[](const Vector4& a, const Vector4& b) { return a==b; });
+    AddBinary<Vector4,Vector4,Flag>("Vector4/equal/exact",NearlySame<Vector4>,[](const Vector4& a, const Vector4& b) { return a.x==b.x && a.y==b.y && a.z==b.z && a.w==b.w; });
+}
+
+void RegisterMatrix() {
+    AddBinary<Matrix,Matrix,Matrix>("Matrix/add/operator",SameType<Matrix>,[](const Matrix& a, const Matrix& b) { return a+b; },MatrixBatchSizes);
+    AddBinary<Matrix,Matrix,Matrix>("Matrix/add/raymath",SameType<Matrix>,[](const Matrix& a, const Matrix& b) { return MatrixAdd(a,b); },MatrixBatchSizes);
+    AddBinary<Matrix,Matrix,Matrix>("Matrix/subtract/operator",SameType<Matrix>,[](const Matrix& a, const Matrix& b) { return a-b; },MatrixBatchSizes);
+    AddBinary<Matrix,Matrix,Matrix>("Matrix/subtract/raymath",SameType<Matrix>,[](const Matrix& a, const Matrix& b) { return MatrixSubtract(a,b); },MatrixBatchSizes);
+    AddBinary<Matrix,Matrix,Matrix>("Matrix/multiply/operator",SameType<Matrix>,[](const Matrix& a, const Matrix& b) { return a*b; },MatrixBatchSizes);
+    AddBinary<Matrix,Matrix,Matrix>("Matrix/multiply/raymath",SameType<Matrix>,[](const Matrix& a, const Matrix& b) { return MatrixMultiply(a,b); },MatrixBatchSizes);
+    AddBinary<Matrix,Matrix,Matrix>("Matrix/add_assign/operator",SameType<Matrix>,[](const Matrix& a, const Matrix& b) { Matrix r=a; r+=b; return r; },MatrixBatchSizes);
+    AddBinary<Matrix,Matrix,Matrix>("Matrix/add_assign/raymath",SameType<Matrix>,[](const Matrix& a, const Matrix& b) { return MatrixAdd(a,b); },MatrixBatchSizes);
+    AddBinary<Matrix,Matrix,Matrix>("Matrix/subtract_assign/operator",SameType<Matrix>,[](const Matrix& a, const Matrix& b) { Matrix r=a; r-=b; return r; },MatrixBatchSizes);
+    AddBinary<Matrix,Matrix,Matrix>("Matrix/subtract_assign/raymath",SameType<Matrix>,[](const Matrix& a, const Matrix& b) { return MatrixSubtract(a,b); },MatrixBatchSizes);
+    AddBinary<Matrix,Matrix,Matrix>("Matrix/multiply_assign/operator",SameType<Matrix>,[](const Matrix& a, const Matrix& b) { Matrix r=a; r*=b; return r; },MatrixBatchSizes);
+    AddBinary<Matrix,Matrix,Matrix>("Matrix/multiply_assign/raymath",SameType<Matrix>,[](const Matrix& a, const Matrix& b) { return MatrixMultiply(a,b); },MatrixBatchSizes);
+    AddBinary<Vector3,Matrix,Vector3>("Matrix/transform_vector3/operator",SameType<Matrix>,[](const Vector3& v, const Matrix& m) { return m*v; },MatrixBatchSizes);
+    AddBinary<Vector3,Matrix,Vector3>("Matrix/transform_vector3/raymath",SameType<Matrix>,[](const Vector3& v, const Matrix& m) { return Vector3Transform(v,m); },MatrixBatchSizes);
+}
+
+void RegisterColor() {
+    AddBinary<Color,Color,Color>("Color/add/operator",SameType<Color>,[](const Color& a, const Color& b) { return a+b; });
+    AddBinary<Color,Color,Color>("Color/add/written_out",SameType<Color>,[](const Color& a, const Color& b) {
+    return Color{Saturate(a.r+b.r), Saturate(a.g+b.g), Saturate(a.b+b.b), Saturate(a.a+b.a)};
+    });
+    AddBinary<Color,Color,Color>("Color/subtract/operator",SameType<Color>,[](const Color& a, const Color& b) { return a-b; });
+    AddBinary<Color,Color,Color>("Color/subtract/written_out",SameType<Color>,[](const Color& a, const Color& b) {
+    return Color{Saturate(a.r-b.r), Saturate(a.g-b.g), Saturate(a.b-b.b), Saturate(a.a-b.a)};
+    });
+    AddBinary<Color,Color,Color>("Color/multiply/operator",SameType<Color>,[](const Color& a, const Color& b) { return a*b; });
+    AddBinary<Color,Color,Color>("Color/multiply/written_out",SameType<Color>,[](const Color& a, const Color& b) {
+    return Color{Saturate(a.r*b.r), Saturate(a.g*b.g), Saturate(a.b*b.b), Saturate(a.a*b.a)};
+    });
+    AddBinary<Color,Color,Color>("Color/divide/operator",SameType<Color>,[](const Color& a, const Color& b) { return a/b; });
+    AddBinary<Color,Color,Color>("Color/divide/written_out",SameType<Color>,[](const Color& a, const Color& b) {
+    return Color{Saturate((float)a.r/(float)b.r), Saturate((float)a.g/(float)b.g), Saturate((float)a.b/(float)b.b), Saturate((float)a.a/(float)b.a)};
+    });
+    AddBinary<Color,float,Color>("Color/scale/operator",Scalars,[](const Color& a, float s) { return a*(s*0.02f); });
+    AddBinary<Color,float,Color>("Color/scale/written_out",Scalars,[](const Color& a, float s) {
+        s*=0.02f;
+    return Color{Saturate((float)a.r*s), Saturate((float)a.g*s), Saturate((float)a.b*s), Saturate((float)a.a*s)};
+    });
+    AddBinary<Color,Color,Color>("Color/add_assign/operator",SameType<Color>,[](const Color& a, const Color& b) { Color r=a; r+=b; return r; });
+    AddBinary<Color,Color,Color>("Color/add_assign/written_out",SameType<Color>,[](const Color& a, const Color& b) {
+    return Color{Saturate(a.r+b.r), Saturate(a.g+b.g), Saturate(a.b+b.b), Saturate(a.a+b.a)};
+    });
+    AddBinary<Color,Color,Color>("Color/subtract_assign/operator",SameType<Color>,[](const Color& a, const Color& b) { Color r=a; r-=b; return r; });
+    AddBinary<Color,Color,Color>("Color/subtract_assign/written_out",SameType<Color>,[](const Color& a, const Color& b) {
+    return Color{Saturate(a.r-b.r), Saturate(a.g-b.g), Saturate(a.b-b.b), Saturate(a.a-b.a)};
+    });
+    AddBinary<Color,Color,Color>("Color/multiply_assign/operator",SameType<Color>,[](const Color& a, const Color& b) { Color r=a; r*=b; return r; });
+    AddBinary<Color,Color,Color>("Color/multiply_assign/written_out",SameType<Color>,[](const Color& a, const Color& b) {
+    return Color{Saturate(a.r*b.r), Saturate(a.g*b.g), Saturate(a.b*b.b), Saturate(a.a*b.a)};
+    });
+    AddBinary<Color,Color,Color>("Color/divide_assign/operator",SameType<Color>,[](const Color& a, const Color& b) { Color r=a; r/=b; return r; });
+    AddBinary<Color,Color,Color>("Color/divide_assign/written_out",SameType<Color>,[](const Color& a, const Color& b) {
+    return Color{Saturate((float)a.r/(float)b.r), Saturate((float)a.g/(float)b.g), Saturate((float)a.b/(float)b.b), Saturate((float)a.a/(float)b.a)};
+    });
+    AddBinary<Color,Color,Flag>("Color/equal/operator",SameType<Color>,[](const Color& a, const Color& b) { return a==b; });
+    AddBinary<Color,Color,Flag>("Color/equal/memcmp",SameType<Color>,[](const Color& a, const Color& b) { return std::memcmp(&a,&b,sizeof(Color))==0; });
+}
+
+void RegisterOutput() {
+    AddText<Vector2>("Vector2/print/operator<<",StreamText<Vector2>);
+    AddText<Vector2>("Vector2/print/FormatTo",FormatText<Vector2>);
+    AddText<Vector2>("Vector2/print/printf",[](const Vector2& v) { return PrintfText(v); });
+    AddText<Vector3>("Vector3/print/operator<<",StreamText<Vector3>);
+    AddText<Vector3>("Vector3/print/FormatTo",FormatText<Vector3>);
+    AddText<Vector3>("Vector3/print/printf",[](const Vector3& v) { return PrintfText(v); });
+    AddText<Vector4>("Vector4/print/operator<<",StreamText<Vector4>);
+    AddText<Vector4>("Vector4/print/FormatTo",FormatText<Vector4>);
+    AddText<Vector4>("Vector4/print/printf",[](const Vector4& v) { return PrintfText(v); });
+    AddText<Color>("Color/print/operator<<",StreamText<Color>);
+    AddText<Color>("Color/print/FormatTo",FormatText<Color>);
+    AddText<Color>("Color/print/printf",[](const Color& c) { return PrintfText(c); });
+    AddText<Matrix>("Matrix/print/operator<<",StreamText<Matrix>);
+    AddText<Matrix>("Matrix/print/FormatTo",FormatText<Matrix>);
+    AddText<Matrix>("Matrix/print/printf",[](const Matrix& m) { return PrintfText(m); });
+    AddText<Rectangle>("Rectangle/print/operator<<",StreamText<Rectangle>);
+    AddText<Rectangle>("Rectangle/print/FormatTo",FormatText<Rectangle>);
+    AddText<Rectangle>("Rectangle/print/printf",[](const Rectangle& r) { return PrintfText(r); });
+    AddText<Image>("Image/print/operator<<",StreamText<Image>);
+    AddText<Image>("Image/print/FormatTo",FormatText<Image>);
+    AddText<Image>("Image/print/printf",[](const Image& i) { return PrintfText(i); });
+    AddText<Texture>("Texture/print/operator<<",StreamText<Texture>);
+    AddText<Texture>("Texture/print/FormatTo",FormatText<Texture>);
+    AddText<Texture>("Texture/print/printf",[](const Texture& t) { return PrintfText(t); });
+    AddText<Camera2D>("Camera2D/print/operator<<",StreamText<Camera2D>);
+    AddText<Camera2D>("Camera2D/print/FormatTo",FormatText<Camera2D>);
+    AddText<Camera2D>("Camera2D/print/printf",[](const Camera2D& c) { return PrintfText(c); });
+    AddText<Camera3D>("Camera3D/print/operator<<",StreamText<Camera3D>);
+    AddText<Camera3D>("Camera3D/print/FormatTo",FormatText<Camera3D>);
+    AddText<Camera3D>("Camera3D/print/printf",[](const Camera3D& c) { return PrintfText(c); });
+    AddText<Ray>("Ray/print/operator<<",StreamText<Ray>);
+    AddText<Ray>("Ray/print/FormatTo",FormatText<Ray>);
+    AddText<Ray>("Ray/print/printf",[](const Ray& r) { return PrintfText(r); });
+    AddText<RayHitInfo>("RayHitInfo/print/operator<<",StreamText<RayHitInfo>);
+    AddText<RayHitInfo>("RayHitInfo/print/FormatTo",FormatText<RayHitInfo>);
+    AddText<RayHitInfo>("RayHitInfo/print/printf",[](const RayHitInfo& h) { return PrintfText(h); });
+    AddText<BoundingBox>("BoundingBox/print/operator<<",StreamText<BoundingBox>);
+    AddText<BoundingBox>("BoundingBox/print/FormatTo",FormatText<BoundingBox>);
+    AddText<BoundingBox>("BoundingBox/print/printf",[](const BoundingBox& b) { return PrintfText(b); });
+    AddText<NPatchInfo>("NPatchInfo/print/operator<<",StreamText<NPatchInfo>);
+    AddText<NPatchInfo>("NPatchInfo/print/FormatTo",FormatText<NPatchInfo>);
+    AddText<NPatchInfo>("NPatchInfo/print/printf",[](const NPatchInfo& p) { return PrintfText(p); });
+    AddText<CharInfo>("CharInfo/print/operator<<",StreamText<CharInfo>);
+    AddText<CharInfo>("CharInfo/print/FormatTo",FormatText<CharInfo>);
+    AddText<CharInfo>("CharInfo/print/printf",[](const CharInfo& c) { return PrintfText(c); });
+    AddText<Font>("Font/print/operator<<",StreamText<Font>);
+    AddText<Font>("Font/print/FormatTo",FormatText<Font>);
+    AddText<Font>("Font/print/printf",[](const Font& f) { return PrintfText(f); });
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    RegisterVector2();
+    RegisterVector3();
+    RegisterVector4();
+    RegisterMatrix();
+    RegisterColor();
+    RegisterOutput();
+    benchmark::Initialize(&argc,argv);
+    if (benchmark::ReportUnrecognizedArguments(argc,argv)) return 1;
+    benchmark::AddCustomContext("simd_backend",RaylibOps::Simd::BackendName);
+#if defined(EQUALITY_OPERATOR_SIMPLE)
+    benchmark::AddCustomContext("equality_operator","SIMPLE");
+#elif defined(EQUALITY_OPERATOR_KNUTH)
+    benchmark::AddCustomContext("equality_operator","KNUTH");
+#endif
+#ifdef VECTOR_EXPRESSION_TEMPLATES
+    benchmark::AddCustomContext("vector_expression_templates","on");
+#endif
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+return 0;
+}
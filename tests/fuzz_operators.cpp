@@ -0,0 +1,1839 @@
+// **************************************************************
+//
+//      C++ Operator Overloads for RayLib: fuzz test
+//
+// **************************************************************
+//
+// Compares the Vector2, Vector3, Vector4, Vector2i, Vector3i, Matrix, Color, Rectangle and BoundingBox operators with the raymath function each wraps, or
+// with the same arithmetic written out where raymath has none, on random operands mixed with zeros of both signs, denormals, the largest floats,
+// infinities and NaN.  Float results must match bit for bit, any NaN matching any NaN.  The batched kernels (VectorArray, TransformPoints, NlerpQuats,
+// ColorSpan, EqualityMask) are compared with the same references element by element, Weld() with welding by brute force, CastRays() with boxes with
+// CheckCollisionRayBox() on every box, OverlapMask() and the & operators with CheckCollisionBoxes() and CheckCollisionRecs(), a Frustum with the corners
+// of each box in clip space, the Image operators in each 8 bit and float format with the Color operators and float arithmetic channel by channel,
+// LinearColor with the sRGB formulas, Sum(), Mean() and Bounds() with double sums, a loop of std::min and std::max and each other for 1 and 3 threads,
+// AsyncLog under eight threads posting at once with what they posted, CameraSnapshot and CameraSnapshot2D with the raylib camera matrices, recomputing
+// exactly when the camera changes, operator== with the formula of its EQUALITY_OPERATOR_ mode, and the operator<< of every raylib struct, from Vector2 to
+// Font, with inserting each piece into the stream as the overloads once did, and the Vector2, Vector3, Vector4, Color, Matrix and Rectangle operator<<
+// printed with setprecision(9), hexfloat and showpos with what operator>> and FromChars() read back, one value at a time and into a std::vector.  Fixed
+// cases recheck bugs fixed before (Color channels, unary minus, HashGrid with infinities and NaN, swapping arrays between an arena and the heap), that
+// division by zero throws under DIVISION_BY_ZERO_THROW, that the Image operators throw on packed formats and on images of different sizes, what the
+// reductions of no points return, that the labels of a Rectangle parse exactly and the binary layout of CharInfo byte by byte, that under
+// INSTRUMENT_OVERLOADS Snapshot() keeps the calls of a thread which has exited, Reset() starts counting from zero and Report() prints the counts, and
+// static_asserts check that operator/ is constexpr in the builds which are not instrumented.  Nothing else is covered: the Quat operators, Slerp,
+// CastRays() with spheres and the rest of the library are not checked here.
+// When everything matches, a few operators are timed against raymath so that the throughput of each backend can be compared.
+//
+// tests/CMakeLists.txt builds this file once for each combination of options, compiled with -ffp-contract=off so raymath's a*b+c is never fused.
+// The optional argument is the number of random cases per operator, e.g. fuzz_paren_knuth_simd 1000000
+
+#include "RaylibOpsArithmetic.hpp"
+#include "RaylibOpsEquality.hpp"
+#include "RaylibOpsBatched.hpp"
+#include "RaylibOpsOutput.hpp"
+#include "RaylibOpsInput.hpp"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using RaylibOps::Vector2i;
+using RaylibOps::Vector3i;
+using RaylibOps::Quat;
+
+namespace {
+
+std::mt19937 Rng(0x52617931);
+std::size_t Failures=0;
+const std::size_t MaxReported=20;
+
+// ********************************************
+//
+//    Operands
+//
+// ********************************************
+
+const float Specials[]={0.0f, -0.0f, 1.0f, -1.0f, 0.5f, 3.0f, FLT_EPSILON, FLT_MIN, -FLT_MIN, std::numeric_limits<float>::denorm_min(), -std::numeric_limits<float>::denorm_min(),
+                        FLT_MAX, -FLT_MAX, std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN()};
+
+float RandomFloat() {
+    unsigned int kind=Rng()%8;
+    if (kind==0) return Specials[Rng()%(sizeof(Specials)/sizeof(Specials[0]))];
+    if (kind==1) {  //Any bit pattern, NaNs included
+        std::uint32_t bits=(std::uint32_t)Rng();
+        float f;
+        std::memcpy(&f,&bits,sizeof f);
+        return f;
+    }
+    if (kind==2) return std::uniform_real_distribution<float>(-1e-3f,1e-3f)(Rng);
+    if (kind==3) return std::uniform_real_distribution<float>(-1e30f,1e30f)(Rng);
+return std::uniform_real_distribution<float>(-1000.0f,1000.0f)(Rng);
+}
+
+float NonZeroFloat() {
+    float f=RandomFloat();
+    while (f==0.0f) f=RandomFloat();
+return f;
+}
+
+int RandomInt(int limit) { return std::uniform_int_distribution<int>(-limit,limit)(Rng); }
+
+unsigned char RandomChannel() {
+    const unsigned char edges[]={0, 1, 2, 127, 128, 254, 255};
+    if (Rng()%4==0) return edges[Rng()%sizeof(edges)];
+return (unsigned char)(Rng()&0xFF);
+}
+
+//Any struct of floats: Vector2, Vector3, Vector4, Matrix, Quat
+template<typename T> void Randomize(T& t) {
+    static_assert(sizeof(T)%sizeof(float)==0, "Randomize() takes structs of floats");
+    float f[sizeof(T)/sizeof(float)];
+    for (float& x : f) x=RandomFloat();
+    std::memcpy(&t,f,sizeof(T));
+}
+
+void Randomize(Color& c) { c=Color{RandomChannel(), RandomChannel(), RandomChannel(), RandomChannel()}; }
+void Randomize(Vector2i& v) { v=Vector2i{RandomInt(1000000), RandomInt(1000000)}; }  //Small enough that products with RandomInt(1000) never overflow
+void Randomize(Vector3i& v) { v=Vector3i{RandomInt(1000000), RandomInt(1000000), RandomInt(1000000)}; }
+
+//Structs with integer fields, for printing.  Sizes and formats may be negative or out of range, and there are no pixels or glyphs.
+void Randomize(Image& i) { i=Image{nullptr, RandomInt(5000), RandomInt(5000), RandomInt(16), RandomInt(25)}; }
+void Randomize(Texture& t) { t=Texture{(unsigned int)Rng(), RandomInt(5000), RandomInt(5000), RandomInt(16), RandomInt(25)}; }
+
+void Randomize(Camera3D& c) {
+    Randomize(c.position);
+    Randomize(c.target);
+    Randomize(c.up);
+    c.fovy=RandomFloat();
+    c.projection=(int)(Rng()%3);  //2 is neither mode
+}
+
+void Randomize(RayHitInfo& h) {
+    h.hit=Rng()%2==0;
+    h.distance=RandomFloat();
+    Randomize(h.position);
+    Randomize(h.normal);
+}
+
+void Randomize(NPatchInfo& n) {
+    Randomize(n.source);
+    n=NPatchInfo{n.source, RandomInt(1000000), RandomInt(1000000), RandomInt(1000000), RandomInt(1000000), RandomInt(3)};
+}
+
+void Randomize(CharInfo& c) {
+    Randomize(c.image);
+    c=CharInfo{RandomInt(0x10FFFF), RandomInt(1000), RandomInt(1000), RandomInt(1000), c.image};
+}
+
+void Randomize(Font& f) {
+    Randomize(f.texture);
+    f=Font{RandomInt(1000), RandomInt(100000), RandomInt(100), f.texture, nullptr, nullptr};
+}
+
+template<typename T> T Random() {
+    T t;
+    Randomize(t);
+return t;
+}
+
+template<typename T> std::vector<T> RandomVector(std::size_t n) {
+    std::vector<T> v(n);
+    for (T& t : v) Randomize(t);
+return v;
+}
+
+//Values in [-100,100] for timing, since denormals, infinities and NaN are slow on some hardware
+template<typename T> std::vector<T> ModerateVector(std::size_t n) {
+    std::vector<T> v(n);
+    std::uniform_real_distribution<float> d(-100.0f,100.0f);
+    for (T& t : v) {
+        float f[sizeof(T)/sizeof(float)];
+        for (float& x : f) x=d(Rng);
+        std::memcpy(&t,f,sizeof(T));
+    }
+return v;
+}
+
+// ********************************************
+//
+//    Comparison and reporting
+//
+// ********************************************
+
+bool Same(float a, float b) {
+    std::uint32_t x, y;
+    std::memcpy(&x,&a,sizeof x);
+    std::memcpy(&y,&b,sizeof y);
+return (x==y) || (a!=a && b!=b);
+}
+
+bool Same(bool a, bool b) { return a==b; }
+bool Same(const std::string& a, const std::string& b) { return a==b; }
+bool Same(const Color& a, const Color& b) { return std::memcmp(&a,&b,sizeof(Color))==0; }
+bool Same(const Vector2i& a, const Vector2i& b) { return std::memcmp(&a,&b,sizeof(Vector2i))==0; }
+bool Same(const Vector3i& a, const Vector3i& b) { return std::memcmp(&a,&b,sizeof(Vector3i))==0; }
+
+template<typename T> bool Same(const T& a, const T& b) {
+    float x[sizeof(T)/sizeof(float)], y[sizeof(T)/sizeof(float)];
+    std::memcpy(x,&a,sizeof(T));
+    std::memcpy(y,&b,sizeof(T));
+    for (std::size_t i=0; i<sizeof(T)/sizeof(float); i++) {
+        if (!Same(x[i],y[i])) return false;
+    }
+return true;
+}
+
+//Printed with printf, not with the operator<< under test
+std::string Show(float f) {
+    char text[32];
+    std::snprintf(text,sizeof text,"%.9g",f);
+return text;
+}
+
+std::string Show(bool b) { return b?"true":"false"; }
+std::string Show(const std::string& s) { return "\""+s+"\""; }
+
+std::string Show(const Color& c) {
+    char text[32];
+    std::snprintf(text,sizeof text,"{%u,%u,%u,%u}",c.r,c.g,c.b,c.a);
+return text;
+}
+
+std::string Show(const Vector2i& v) { return "{"+std::to_string(v.x)+","+std::to_string(v.y)+"}"; }
+std::string Show(const Vector3i& v) { return "{"+std::to_string(v.x)+","+std::to_string(v.y)+","+std::to_string(v.z)+"}"; }
+
+template<typename T> std::string Show(const T& t) {
+    float f[sizeof(T)/sizeof(float)];
+    std::memcpy(f,&t,sizeof(T));
+    std::string s="{";
+    for (std::size_t i=0; i<sizeof(T)/sizeof(float); i++) s+=(i?",":"")+Show(f[i]);
+return s+"}";
+}
+
+//Counts a mismatch of got and want, and prints the first few along with the operands which produced them
+template<typename R, typename... Operands> void Expect(const char* type, const char* operation, const R& got, const R& want, const Operands&... operands) {
+    if (Same(got,want)) return;
+    if (Failures++<MaxReported) {
+        std::printf("MISMATCH %s %s: got %s, expected %s.  Operands:",type,operation,Show(got).c_str(),Show(want).c_str());
+        ((std::printf(" %s",Show(operands).c_str())), ...);
+        std::printf("\n");
+    }
+}
+
+//Counts an operation which does not throw std::domain_error as a mismatch
+template<typename Operation> void ExpectThrows(const char* type, const char* operation, Operation run) {
+    bool threw=false;
+    try { run(); }
+    catch (const std::domain_error&) { threw=true; }
+    Expect(type,operation,threw,true);
+}
+
+// ********************************************
+//
+//    References
+//
+// ********************************************
+//
+// The raymath function each operator replaces.  raymath has no Vector4 or integer vector arithmetic, so theirs is written out.
+
+template<typename V> struct Reference;
+
+template<> struct Reference<Vector2> {
+    static Vector2 Add(Vector2 a, Vector2 b) { return Vector2Add(a,b); }
+    static Vector2 Subtract(Vector2 a, Vector2 b) { return Vector2Subtract(a,b); }
+    static Vector2 Scale(Vector2 a, float s) { return Vector2Scale(a,s); }
+    static Vector2 Divide(Vector2 a, float s) { return Vector2Scale(a,1.0f/s); }
+    static Vector2 Negate(Vector2 a) { return Vector2Negate(a); }
+};
+
+template<> struct Reference<Vector3> {
+    static Vector3 Add(Vector3 a, Vector3 b) { return Vector3Add(a,b); }
+    static Vector3 Subtract(Vector3 a, Vector3 b) { return Vector3Subtract(a,b); }
+    static Vector3 Scale(Vector3 a, float s) { return Vector3Scale(a,s); }
+    static Vector3 Divide(Vector3 a, float s) { return Vector3Scale(a,1.0f/s); }
+    static Vector3 Negate(Vector3 a) { return Vector3Negate(a); }
+};
+
+template<> struct Reference<Vector4> {
+    static Vector4 Add(Vector4 a, Vector4 b) { return Vector4{a.x+b.x, a.y+b.y, a.z+b.z, a.w+b.w}; }
+    static Vector4 Subtract(Vector4 a, Vector4 b) { return Vector4{a.x-b.x, a.y-b.y, a.z-b.z, a.w-b.w}; }
+    static Vector4 Scale(Vector4 a, float s) { return Vector4{a.x*s, a.y*s, a.z*s, a.w*s}; }
+    static Vector4 Divide(Vector4 a, float s) { return Scale(a,1.0f/s); }
+    static Vector4 Negate(Vector4 a) { return Vector4{-a.x, -a.y, -a.z, -a.w}; }
+};
+
+template<> struct Reference<Vector2i> {
+    static Vector2i Add(Vector2i a, Vector2i b) { return Vector2i{a.x+b.x, a.y+b.y}; }
+    static Vector2i Subtract(Vector2i a, Vector2i b) { return Vector2i{a.x-b.x, a.y-b.y}; }
+    static Vector2i Scale(Vector2i a, int s) { return Vector2i{a.x*s, a.y*s}; }
+    static Vector2i Divide(Vector2i a, int s) { return Vector2i{a.x/s, a.y/s}; }
+    static Vector2i Negate(Vector2i a) { return Vector2i{-a.x, -a.y}; }
+};
+
+template<> struct Reference<Vector3i> {
+    static Vector3i Add(Vector3i a, Vector3i b) { return Vector3i{a.x+b.x, a.y+b.y, a.z+b.z}; }
+    static Vector3i Subtract(Vector3i a, Vector3i b) { return Vector3i{a.x-b.x, a.y-b.y, a.z-b.z}; }
+    static Vector3i Scale(Vector3i a, int s) { return Vector3i{a.x*s, a.y*s, a.z*s}; }
+    static Vector3i Divide(Vector3i a, int s) { return Vector3i{a.x/s, a.y/s, a.z/s}; }
+    static Vector3i Negate(Vector3i a) { return Vector3i{-a.x, -a.y, -a.z}; }
+};
+
+float RandomScalar(float) { return RandomFloat(); }
+int RandomScalar(int) { return RandomInt(1000); }
+float NonZeroScalar(float) { return NonZeroFloat(); }
+
+int NonZeroScalar(int) {
+    int s=RandomInt(1000);
+return (s!=0)?s:1;
+}
+
+//One channel of each Color operator, as the original overloads computed it: widen, operate, clamp to 0..255
+unsigned char ReferenceAdd(unsigned char a, unsigned char b) { return (unsigned char)((a+b>255)?255:a+b); }
+unsigned char ReferenceSubtract(unsigned char a, unsigned char b) { return (unsigned char)((a>b)?a-b:0); }
+unsigned char ReferenceDifference(unsigned char a, unsigned char b) { return (unsigned char)((a>b)?a-b:b-a); }
+
+#ifndef COLOR_MODULATE_NORMALIZED
+unsigned char ReferenceMultiply(unsigned char a, unsigned char b) { return (unsigned char)((a*b>255)?255:a*b); }
+unsigned char ReferenceDivide(unsigned char a, unsigned char b) { return (unsigned char)((b!=0)?a/b:(a!=0)?255:0); }
+#else
+unsigned char ReferenceMultiply(unsigned char a, unsigned char b) { return (unsigned char)((a*b+127)/255); }
+
+unsigned char ReferenceDivide(unsigned char a, unsigned char b) {
+    if (b==0) return (a!=0)?255:0;
+    int quotient=(a*255+b/2)/b;
+return (unsigned char)((quotient>255)?255:quotient);
+}
+#endif
+
+unsigned char ReferenceClamp(float f) {
+    if (f!=f || f<=0.0f) return 0;
+    if (f>=255.0f) return 255;
+return (unsigned char)f;
+}
+
+Color ReferenceColor(const Color& a, const Color& b, unsigned char (*op)(unsigned char, unsigned char)) { return Color{op(a.r,b.r), op(a.g,b.g), op(a.b,b.b), op(a.a,b.a)}; }
+Color ReferenceScale(const Color& a, float s) { return Color{ReferenceClamp(a.r*s), ReferenceClamp(a.g*s), ReferenceClamp(a.b*s), ReferenceClamp(a.a*s)}; }
+Color ReferenceDivide(const Color& a, float s) { return Color{ReferenceClamp(a.r/s), ReferenceClamp(a.g/s), ReferenceClamp(a.b/s), ReferenceClamp(a.a/s)}; }
+
+// ********************************************
+//
+//    Vector, matrix and color operators
+//
+// ********************************************
+
+template<typename V> void FuzzVector(const char* type, std::size_t cases) {
+    typedef Reference<V> R;
+    typedef typename RaylibOps::VectorTraits<V>::Scalar Scalar;
+    for (std::size_t i=0; i<cases; i++) {
+        V a=Random<V>(), b=Random<V>();
+        Scalar s=RandomScalar(Scalar()), d=NonZeroScalar(Scalar());
+
+        V sum=a+b, difference=a-b, scaled=a*s, scaledLeft=s*a, quotient=a/d, negated=-a;
+        Expect(type,"a+b",sum,R::Add(a,b),a,b);
+        Expect(type,"a-b",difference,R::Subtract(a,b),a,b);
+        Expect(type,"a*s",scaled,R::Scale(a,s),a,s);
+        Expect(type,"s*a",scaledLeft,R::Scale(a,s),a,s);
+        Expect(type,"a/s",quotient,R::Divide(a,d),a,d);
+        Expect(type,"-a",negated,R::Negate(a),a);
+
+        V c=a;
+        c+=b;
+        Expect(type,"a+=b",c,R::Add(a,b),a,b);
+        c=a;
+        c-=b;
+        Expect(type,"a-=b",c,R::Subtract(a,b),a,b);
+        c=a;
+        c*=s;
+        Expect(type,"a*=s",c,R::Scale(a,s),a,s);
+        c=a;
+        c/=d;
+        Expect(type,"a/=s",c,R::Divide(a,d),a,d);
+
+        //One expression of several operators, which VECTOR_EXPRESSION_TEMPLATES evaluates in a single pass
+        V mixed=s*a-(b+a*d)+(-b);
+        Expect(type,"s*a-(b+a*d)+(-b)",mixed,R::Add(R::Subtract(R::Scale(a,s),R::Add(b,R::Scale(a,d))),R::Negate(b)),a,b,s,d);
+    }
+}
+
+void FuzzMatrix(std::size_t cases) {
+    for (std::size_t i=0; i<cases; i++) {
+        Matrix a=Random<Matrix>(), b=Random<Matrix>();
+        Vector3 v=Random<Vector3>();
+        Vector4 q=Random<Vector4>();
+
+        Expect("Matrix","a+b",a+b,MatrixAdd(a,b),a,b);
+        Expect("Matrix","a-b",a-b,MatrixSubtract(a,b),a,b);
+        Expect("Matrix","a*b",a*b,MatrixMultiply(a,b),a,b);
+        Expect("Matrix","m*Vector3",a*v,Vector3Transform(v,a),a,v);
+        Expect("Matrix","m*Vector4",a*q,QuaternionTransform(q,a),a,q);
+
+        Matrix c=a;
+        c+=b;
+        Expect("Matrix","a+=b",c,MatrixAdd(a,b),a,b);
+        c=a;
+        c-=b;
+        Expect("Matrix","a-=b",c,MatrixSubtract(a,b),a,b);
+        c=a;
+        c*=b;
+        Expect("Matrix","a*=b",c,MatrixMultiply(a,b),a,b);
+    }
+}
+
+void FuzzColor(std::size_t cases) {
+    for (std::size_t i=0; i<cases; i++) {
+        Color a=Random<Color>(), b=Random<Color>();
+        float s=RandomFloat();
+
+        Expect("Color","a+b",a+b,ReferenceColor(a,b,ReferenceAdd),a,b);
+        Expect("Color","a-b",a-b,ReferenceColor(a,b,ReferenceSubtract),a,b);
+        Expect("Color","a*b",a*b,ReferenceColor(a,b,ReferenceMultiply),a,b);
+        Expect("Color","a/b",a/b,ReferenceColor(a,b,ReferenceDivide),a,b);
+        Expect("Color","a*s",a*s,ReferenceScale(a,s),a,s);
+        Expect("Color","a/s",a/s,ReferenceDivide(a,s),a,s);
+
+        Color c=a;
+        c+=b;
+        Expect("Color","a+=b",c,ReferenceColor(a,b,ReferenceAdd),a,b);
+        c=a;
+        c-=b;
+        Expect("Color","a-=b",c,ReferenceColor(a,b,ReferenceSubtract),a,b);
+        c=a;
+        c*=b;
+        Expect("Color","a*=b",c,ReferenceColor(a,b,ReferenceMultiply),a,b);
+        c=a;
+        c/=b;
+        Expect("Color","a/=b",c,ReferenceColor(a,b,ReferenceDivide),a,b);
+        c=a;
+        c*=s;
+        Expect("Color","a*=s",c,ReferenceScale(a,s),a,s);
+        c=a;
+        c/=s;
+        Expect("Color","a/=s",c,ReferenceDivide(a,s),a,s);
+        Expect("Color","a==b",a==b,a.r==b.r && a.g==b.g && a.b==b.b && a.a==b.a,a,b);
+    }
+}
+
+//An integer rectangle near the origin, so that many share an edge.  None is zero wide: CheckCollisionRecs() counts a line inside a rectangle as colliding.
+Rectangle IntegerRectangle() { return Rectangle{(float)RandomInt(4), (float)RandomInt(4), (float)(1+Rng()%3), (float)(1+Rng()%3)}; }
+
+//An integer box within limit of the origin, less than extent long on each axis and often flat, so that many share a face
+BoundingBox IntegerBox(int limit, unsigned int extent) {
+    BoundingBox b;
+    b.min=Vector3{(float)RandomInt(limit), (float)RandomInt(limit), (float)RandomInt(limit)};
+    b.max=Vector3{b.min.x+(float)(Rng()%extent), b.min.y+(float)(Rng()%extent), b.min.z+(float)(Rng()%extent)};
+return b;
+}
+
+//std::min and std::max return the first argument when the two are unordered, as the operators do
+Vector3 ReferenceLesser(const Vector3& a, const Vector3& b) { return Vector3{std::min(a.x,b.x), std::min(a.y,b.y), std::min(a.z,b.z)}; }
+Vector3 ReferenceGreater(const Vector3& a, const Vector3& b) { return Vector3{std::max(a.x,b.x), std::max(a.y,b.y), std::max(a.z,b.z)}; }
+
+BoundingBox ReferenceScale(const BoundingBox& b, const Vector3& s) {
+    Vector3 p{b.min.x*s.x, b.min.y*s.y, b.min.z*s.z}, q{b.max.x*s.x, b.max.y*s.y, b.max.z*s.z};
+return BoundingBox{ReferenceLesser(p,q), ReferenceGreater(p,q)};
+}
+
+//The Rectangle operators against their arithmetic written out.  On integer rectangles a&b must also be GetCollisionRec(a,b), and empty exactly when
+//CheckCollisionRecs(a,b) is false, touching edges included.
+void FuzzRectangle(std::size_t cases) {
+    for (std::size_t i=0; i<cases; i++) {
+        Rectangle a=Random<Rectangle>(), b=Random<Rectangle>();
+        Vector2 v=Random<Vector2>();
+        float s=RandomFloat();
+
+        Expect("Rectangle","a+v",a+v,Rectangle{a.x+v.x, a.y+v.y, a.width, a.height},a,v);
+        Expect("Rectangle","a-v",a-v,Rectangle{a.x-v.x, a.y-v.y, a.width, a.height},a,v);
+        Expect("Rectangle","a*s",a*s,Rectangle{a.x*s, a.y*s, a.width*s, a.height*s},a,s);
+        Expect("Rectangle","a*v",a*v,Rectangle{a.x*v.x, a.y*v.y, a.width*v.x, a.height*v.y},a,v);
+        float left=std::min(a.x,b.x), top=std::min(a.y,b.y);
+        Rectangle joined{left, top, std::max(a.x+a.width,b.x+b.width)-left, std::max(a.y+a.height,b.y+b.height)-top};
+        Expect("Rectangle","a|b",a|b,joined,a,b);
+        left=std::max(a.x,b.x);
+        top=std::max(a.y,b.y);
+        Rectangle overlap{left, top, std::min(a.x+a.width,b.x+b.width)-left, std::min(a.y+a.height,b.y+b.height)-top};
+        if (!CheckCollisionRecs(a,b)) overlap=Rectangle{0.0f, 0.0f, 0.0f, 0.0f};
+        Expect("Rectangle","a&b",a&b,overlap,a,b);
+
+        Rectangle c=a;
+        c+=v;
+        Expect("Rectangle","a+=v",c,a+v,a,v);
+        c=a;
+        c-=v;
+        Expect("Rectangle","a-=v",c,a-v,a,v);
+        c=a;
+        c*=s;
+        Expect("Rectangle","a*=s",c,a*s,a,s);
+        c=a;
+        c*=v;
+        Expect("Rectangle","a*=v",c,a*v,a,v);
+        c=a;
+        c|=b;
+        Expect("Rectangle","a|=b",c,joined,a,b);
+        c=a;
+        c&=b;
+        Expect("Rectangle","a&=b",c,overlap,a,b);
+
+        Rectangle p=IntegerRectangle(), q=IntegerRectangle();
+        Expect("Rectangle","a&b of integers",p&q,GetCollisionRec(p,q),p,q);
+        Expect("Rectangle","IsEmpty(a&b) of integers",RaylibOps::IsEmpty(p&q),!CheckCollisionRecs(p,q),p,q);
+    }
+}
+
+//The BoundingBox operators against raymath or their arithmetic written out.  On integer boxes a&b must be empty exactly when CheckCollisionBoxes(a,b) is
+//false, touching faces included.
+void FuzzBoundingBox(std::size_t cases) {
+    for (std::size_t i=0; i<cases; i++) {
+        BoundingBox a=Random<BoundingBox>(), b=Random<BoundingBox>();
+        Vector3 v=Random<Vector3>();
+        float s=RandomFloat();
+
+        Expect("BoundingBox","a+v",a+v,BoundingBox{Vector3Add(a.min,v), Vector3Add(a.max,v)},a,v);
+        Expect("BoundingBox","a-v",a-v,BoundingBox{Vector3Subtract(a.min,v), Vector3Subtract(a.max,v)},a,v);
+        Expect("BoundingBox","a*v",a*v,ReferenceScale(a,v),a,v);
+        Expect("BoundingBox","a*s",a*s,ReferenceScale(a,Vector3{s,s,s}),a,s);
+        BoundingBox joined{ReferenceLesser(a.min,b.min), ReferenceGreater(a.max,b.max)}, overlap{ReferenceGreater(a.min,b.min), ReferenceLesser(a.max,b.max)};
+        Expect("BoundingBox","a|b",a|b,joined,a,b);
+        Expect("BoundingBox","a|p",a|v,BoundingBox{ReferenceLesser(a.min,v), ReferenceGreater(a.max,v)},a,v);
+        Expect("BoundingBox","a&b",a&b,overlap,a,b);
+
+        BoundingBox c=a;
+        c+=v;
+        Expect("BoundingBox","a+=v",c,a+v,a,v);
+        c=a;
+        c-=v;
+        Expect("BoundingBox","a-=v",c,a-v,a,v);
+        c=a;
+        c*=v;
+        Expect("BoundingBox","a*=v",c,a*v,a,v);
+        c=a;
+        c*=s;
+        Expect("BoundingBox","a*=s",c,a*s,a,s);
+        c=a;
+        c|=b;
+        Expect("BoundingBox","a|=b",c,joined,a,b);
+        c=a;
+        c|=v;
+        Expect("BoundingBox","a|=p",c,a|v,a,v);
+        c=a;
+        c&=b;
+        Expect("BoundingBox","a&=b",c,overlap,a,b);
+
+        BoundingBox p=IntegerBox(4,3), q=IntegerBox(4,3);
+        Expect("BoundingBox","IsEmpty(a&b) of integers",RaylibOps::IsEmpty(p&q),!CheckCollisionBoxes(p,q),p,q);
+        Expect("BoundingBox","Overlaps() of integers",RaylibOps::Overlaps(p,q),CheckCollisionBoxes(p,q),p,q);
+    }
+}
+
+// ********************************************
+//
+//    Equality
+//
+// ********************************************
+
+//Whether a==b compiles for V
+template<typename V, typename=void> struct HasEquality : std::false_type {};
+template<typename V> struct HasEquality<V, decltype(void(std::declval<const V&>()==std::declval<const V&>()))> : std::true_type {};
+
+#if defined(EQUALITY_OPERATOR_SIMPLE) || defined(EQUALITY_OPERATOR_KNUTH)
+static_assert(HasEquality<Vector2>::value && HasEquality<Vector3>::value && HasEquality<Vector4>::value, "EQUALITY_OPERATOR_ defines == for the float vectors");
+#else
+static_assert(!HasEquality<Vector2>::value && !HasEquality<Vector3>::value && !HasEquality<Vector4>::value, "Without an EQUALITY_OPERATOR_ option, == on float vectors does not compile");
+#endif
+static_assert(HasEquality<Color>::value && HasEquality<Vector2i>::value && HasEquality<Vector3i>::value, "Colors and integer vectors always compare exactly");
+
+//The formula of the original EQUALITY_OPERATOR_KNUTH overloads
+bool KnuthEqual(float a, float b) { return std::fabs(a-b) <= ( (std::fabs(a)>std::fabs(b) ? std::fabs(b) : std::fabs(a)) * std::numeric_limits<float>::epsilon() ); }
+
+bool UlpsEqual(float a, float b, long long ulps) {
+    if (a!=a || b!=b) return false;
+    std::int32_t x, y;
+    std::memcpy(&x,&a,sizeof x);
+    std::memcpy(&y,&b,sizeof y);
+    long long ox=(x<0)?-(long long)(x&0x7fffffff):x, oy=(y<0)?-(long long)(y&0x7fffffff):y;  //-0 and +0 both map to 0
+return std::llabs(ox-oy)<=ulps;
+}
+
+template<typename V, typename Equal> bool AllEqual(const V& a, const V& b, Equal equal) {
+    bool all=true;
+    for (int c=0; c<RaylibOps::VectorTraits<V>::Dimension; c++) all=all && equal(a.*RaylibOps::VectorTraits<V>::Components[c],b.*RaylibOps::VectorTraits<V>::Components[c]);
+return all;
+}
+
+bool ExactReference(const float a, const float b) { return a==b; }
+bool KnuthReference(const float a, const float b) { return KnuthEqual(a,b); }
+bool Ulps4Reference(const float a, const float b) { return UlpsEqual(a,b,4); }
+
+#ifdef EQUALITY_OPERATOR_SIMPLE
+bool (* const DefaultReference)(float, float)=ExactReference;
+#else
+bool (* const DefaultReference)(float, float)=KnuthReference;
+#endif
+
+//A vector near v: components a few ulps away, scaled by sqrt(2) and back, unchanged, or random
+template<typename V> V Nearby(const V& v) {
+    V near=v;
+    for (int c=0; c<RaylibOps::VectorTraits<V>::Dimension; c++) {
+        float& f=near.*RaylibOps::VectorTraits<V>::Components[c];
+        unsigned int kind=Rng()%4;
+        if (kind==0) {
+            int steps=(int)(Rng()%11)-5;
+            for (; steps>0; steps--) f=std::nextafter(f,std::numeric_limits<float>::infinity());
+            for (; steps<0; steps++) f=std::nextafter(f,-std::numeric_limits<float>::infinity());
+        }
+        else if (kind==1) f=(f*std::sqrt(2.0f))/std::sqrt(2.0f);
+        else if (kind==2) f=RandomFloat();
+    }
+return near;
+}
+
+template<typename V> void FuzzEquality(const char* type, std::size_t cases) {
+    std::size_t n=cases/8+1;
+    std::vector<V> a=RandomVector<V>(n), b(n);
+    for (std::size_t i=0; i<n; i++) b[i]=Nearby(a[i]);
+
+    for (std::size_t i=0; i<n; i++) {
+#if defined(EQUALITY_OPERATOR_SIMPLE) || defined(EQUALITY_OPERATOR_KNUTH)
+        Expect(type,"a==b",(bool)(a[i]==b[i]),AllEqual(a[i],b[i],DefaultReference),a[i],b[i]);
+#endif
+        Expect(type,"ApproximatelyEqual<ExactTolerance>",(bool)RaylibOps::ApproximatelyEqual<RaylibOps::ExactTolerance>(a[i],b[i]),AllEqual(a[i],b[i],ExactReference),a[i],b[i]);
+        Expect(type,"ApproximatelyEqual<KnuthTolerance>",(bool)RaylibOps::ApproximatelyEqual<RaylibOps::KnuthTolerance>(a[i],b[i]),AllEqual(a[i],b[i],KnuthReference),a[i],b[i]);
+        Expect(type,"ApproximatelyEqual<UlpTolerance<4> >",(bool)RaylibOps::ApproximatelyEqual<RaylibOps::UlpTolerance<4> >(a[i],b[i]),AllEqual(a[i],b[i],Ulps4Reference),a[i],b[i]);
+    }
+
+    RaylibOps::BitMask exact=RaylibOps::EqualityMask<RaylibOps::ExactTolerance>(a.data(),b.data(),n);
+    RaylibOps::BitMask knuth=RaylibOps::EqualityMask<RaylibOps::KnuthTolerance>(a.data(),b.data(),n);
+    for (std::size_t i=0; i<n; i++) {
+        Expect(type,"EqualityMask<ExactTolerance> of arrays",exact[i],AllEqual(a[i],b[i],ExactReference),a[i],b[i]);
+        Expect(type,"EqualityMask<KnuthTolerance> of arrays",knuth[i],AllEqual(a[i],b[i],KnuthReference),a[i],b[i]);
+    }
+}
+
+//The SIMD comparisons of VectorArrays
+template<typename V> void FuzzEqualityMask(const char* type, std::size_t cases) {
+    std::size_t n=cases/8+Rng()%17;  //Usually not a multiple of the SIMD width, so the scalar tail is tested too
+    std::vector<V> a=RandomVector<V>(n), b(n);
+    for (std::size_t i=0; i<n; i++) b[i]=Nearby(a[i]);
+    RaylibOps::VectorArray<V> la(a), lb(b);
+
+    RaylibOps::BitMask defaults=RaylibOps::EqualityMask(la,lb);
+    RaylibOps::BitMask exact=RaylibOps::EqualityMask<RaylibOps::ExactTolerance>(la,lb);
+    RaylibOps::BitMask knuth=RaylibOps::EqualityMask<RaylibOps::KnuthTolerance>(la,lb);
+    RaylibOps::BitMask ulps=RaylibOps::EqualityMask<RaylibOps::UlpTolerance<4> >(la,lb);
+    std::size_t count=0;
+    for (std::size_t i=0; i<n; i++) {
+        Expect(type,"EqualityMask<DefaultTolerance>",defaults[i],AllEqual(a[i],b[i],DefaultReference),a[i],b[i]);
+        Expect(type,"EqualityMask<ExactTolerance>",exact[i],AllEqual(a[i],b[i],ExactReference),a[i],b[i]);
+        Expect(type,"EqualityMask<KnuthTolerance>",knuth[i],AllEqual(a[i],b[i],KnuthReference),a[i],b[i]);
+        Expect(type,"EqualityMask<UlpTolerance<4> >",ulps[i],AllEqual(a[i],b[i],Ulps4Reference),a[i],b[i]);
+        count+=knuth[i];
+    }
+    Expect(type,"BitMask::Count()",knuth.Count()==count,true);
+}
+
+// ********************************************
+//
+//    Batched operations
+//
+// ********************************************
+
+template<typename V> void FuzzVectorArray(const char* type, std::size_t cases) {
+    typedef Reference<V> R;
+    std::size_t n=cases/4+Rng()%17;
+    std::vector<V> a=RandomVector<V>(n), b=RandomVector<V>(n);
+    float s=RandomFloat(), d=NonZeroFloat();
+    const RaylibOps::VectorArray<V> la(a), lb(b);
+
+    RaylibOps::VectorArray<V> sum=la+lb, difference=la-lb, scaled=la*s, quotient=la/d;
+    RaylibOps::VectorArray<V> addAssign=la, subtractAssign=la, scaleAssign=la, divideAssign=la;
+    addAssign+=lb;
+    subtractAssign-=lb;
+    scaleAssign*=s;
+    divideAssign/=d;
+    std::vector<V> roundTrip=la.ToStdVector();
+    for (std::size_t i=0; i<n; i++) {
+        Expect(type,"array a+b",sum[i],R::Add(a[i],b[i]),a[i],b[i]);
+        Expect(type,"array a-b",difference[i],R::Subtract(a[i],b[i]),a[i],b[i]);
+        Expect(type,"array a*s",scaled[i],R::Scale(a[i],s),a[i],s);
+        Expect(type,"array a/s",quotient[i],R::Divide(a[i],d),a[i],d);
+        Expect(type,"array a+=b",addAssign[i],R::Add(a[i],b[i]),a[i],b[i]);
+        Expect(type,"array a-=b",subtractAssign[i],R::Subtract(a[i],b[i]),a[i],b[i]);
+        Expect(type,"array a*=s",scaleAssign[i],R::Scale(a[i],s),a[i],s);
+        Expect(type,"array a/=s",divideAssign[i],R::Divide(a[i],d),a[i],d);
+        Expect(type,"array ToStdVector()",roundTrip[i],a[i]);
+    }
+}
+
+void FuzzTransformPoints(std::size_t cases) {
+    std::size_t n=cases/4+Rng()%17;
+    Matrix m=Random<Matrix>();
+    std::vector<Vector3> in=RandomVector<Vector3>(n), out(n), threaded(n);
+    RaylibOps::TransformPoints(m,in.data(),out.data(),n);
+    RaylibOps::TransformPoints(m,in.data(),threaded.data(),n,3);
+    RaylibOps::Vector3Array lanes(in.size()), inLanes(in);
+    RaylibOps::TransformPoints(m,inLanes,lanes);
+    for (std::size_t i=0; i<n; i++) {
+        Vector3 want=Vector3Transform(in[i],m);
+        Expect("TransformPoints","",out[i],want,m,in[i]);
+        Expect("TransformPoints","with 3 threads",threaded[i],want,m,in[i]);
+        Expect("TransformPoints","of a Vector3Array",lanes[i],want,m,in[i]);
+    }
+}
+
+void FuzzNlerpQuats(std::size_t cases) {
+    std::size_t n=cases/4+Rng()%17;
+    std::vector<Quat> a=RandomVector<Quat>(n), b=RandomVector<Quat>(n), out(n), perJoint(n);
+    std::vector<float> t(n);
+    for (float& f : t) f=std::uniform_real_distribution<float>(0.0f,1.0f)(Rng);
+    float shared=t[0];
+    RaylibOps::NlerpQuats(a.data(),b.data(),shared,out.data(),n,2);
+    RaylibOps::NlerpQuats(a.data(),b.data(),t.data(),perJoint.data(),n);
+    for (std::size_t i=0; i<n; i++) {
+        Expect("NlerpQuats","with one t",out[i],RaylibOps::Nlerp(a[i],b[i],shared),a[i],b[i],shared);
+        Expect("NlerpQuats","with t per joint",perJoint[i],RaylibOps::Nlerp(a[i],b[i],t[i]),a[i],b[i],t[i]);
+    }
+}
+
+void FuzzColorSpan(std::size_t cases) {
+    std::size_t n=cases/4+Rng()%17;
+    std::vector<Color> a=RandomVector<Color>(n), b=RandomVector<Color>(n);
+    Color tint=Random<Color>();
+    float s=RandomFloat();
+
+    //Each of the twelve in-place operators, on a fresh copy of a
+    std::vector<Color> results[12];
+    for (std::vector<Color>& r : results) r=a;
+    const RaylibOps::ColorSpan spanB(b.data(),n);
+    RaylibOps::ColorSpan(results[0].data(),n)+=spanB;
+    RaylibOps::ColorSpan(results[1].data(),n)-=spanB;
+    RaylibOps::ColorSpan(results[2].data(),n)*=spanB;
+    RaylibOps::ColorSpan(results[3].data(),n)/=spanB;
+    RaylibOps::ColorSpan(results[4].data(),n)+=tint;
+    RaylibOps::ColorSpan(results[5].data(),n)-=tint;
+    RaylibOps::ColorSpan(results[6].data(),n)*=tint;
+    RaylibOps::ColorSpan(results[7].data(),n)/=tint;
+    RaylibOps::ColorSpan(results[8].data(),n)*=s;
+    RaylibOps::ColorSpan(results[9].data(),n)/=s;
+    RaylibOps::ColorSpan(results[10].data(),n)*=1.0f;
+    RaylibOps::ColorSpan(results[11].data(),n)/=0.0f;
+    for (std::size_t i=0; i<n; i++) {
+        Expect("ColorSpan","+=span",results[0][i],ReferenceColor(a[i],b[i],ReferenceAdd),a[i],b[i]);
+        Expect("ColorSpan","-=span",results[1][i],ReferenceColor(a[i],b[i],ReferenceSubtract),a[i],b[i]);
+        Expect("ColorSpan","*=span",results[2][i],ReferenceColor(a[i],b[i],ReferenceMultiply),a[i],b[i]);
+        Expect("ColorSpan","/=span",results[3][i],ReferenceColor(a[i],b[i],ReferenceDivide),a[i],b[i]);
+        Expect("ColorSpan","+=Color",results[4][i],ReferenceColor(a[i],tint,ReferenceAdd),a[i],tint);
+        Expect("ColorSpan","-=Color",results[5][i],ReferenceColor(a[i],tint,ReferenceSubtract),a[i],tint);
+        Expect("ColorSpan","*=Color",results[6][i],ReferenceColor(a[i],tint,ReferenceMultiply),a[i],tint);
+        Expect("ColorSpan","/=Color",results[7][i],ReferenceColor(a[i],tint,ReferenceDivide),a[i],tint);
+        Expect("ColorSpan","*=float",results[8][i],ReferenceScale(a[i],s),a[i],s);
+        Expect("ColorSpan","/=float",results[9][i],ReferenceDivide(a[i],s),a[i],s);
+        Expect("ColorSpan","*=1",results[10][i],a[i],a[i]);
+        Expect("ColorSpan","/=0",results[11][i],ReferenceDivide(a[i],0.0f),a[i]);
+    }
+}
+
+//An Image of width x height pixels in mipmaps levels over buffer, which is resized to hold them
+template<typename T> Image LocalImage(std::vector<T>& buffer, int width, int height, int mipmaps, int format) {
+    Image image{nullptr,width,height,mipmaps,format};
+    buffer.resize(RaylibOps::ImageDataSize(image)/sizeof(T));
+    image.data=buffer.data();
+return image;
+}
+
+//The least height from which an image of two mipmap levels has at least 2*ParallelMinimum channels, and a count of channels which is not a multiple of 8, so the
+//SIMD kernels leave a tail wherever the channels per pixel allow it
+int ImageHeight(int width, int format) {
+    const RaylibOps::PixelFormatInfo& f=RaylibOps::PixelFormatLookup(format);
+    const std::size_t channelBytes=(std::size_t)(f.bitsPerPixel/8/f.channels);
+    int height=(int)(2*RaylibOps::ParallelMinimum)/(f.channels*width)+1;
+    for (int tries=0; tries<8; tries++, height++) {
+        if ((RaylibOps::ImageDataSize(Image{nullptr,width,height,2,format})/channelBytes)%8!=0) break;
+    }
+return height;
+}
+
+//The 8 bit pixel at p as a Color, with the channels its format lacks 0
+Color PixelColor(const unsigned char* p, int channels) {
+    Color c{0,0,0,0};
+    std::memcpy(&c,p,(std::size_t)channels);
+return c;
+}
+
+//The image operators on Images over local buffers in each 8 bit and float format: 8 bit pixels against the Color references, float channels against the arithmetic
+//written out.  Each image has two mipmap levels of an odd width, see ImageHeight(), so 3 threads split it partway through a Color.
+void FuzzImages() {
+    struct Format { int format; const char* name; };
+    const Format byteFormats[]={{PIXELFORMAT_UNCOMPRESSED_GRAYSCALE,"GRAYSCALE"}, {PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA,"GRAY_ALPHA"},
+                                {PIXELFORMAT_UNCOMPRESSED_R8G8B8,"R8G8B8"}, {PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,"R8G8B8A8"}};
+    const Format floatFormats[]={{PIXELFORMAT_UNCOMPRESSED_R32,"R32"}, {PIXELFORMAT_UNCOMPRESSED_R32G32B32,"R32G32B32"}, {PIXELFORMAT_UNCOMPRESSED_R32G32B32A32,"R32G32B32A32"}};
+    const char* ways[]={" with 1 thread"," with 3 threads"," operators"};
+    const Color tint=Random<Color>();
+    for (const Format& f : byteFormats) {
+        const float s=(float)(Rng()%1024)/256.0f;  //Moderate, so most channels do not saturate
+        const int channels=RaylibOps::PixelFormatLookup(f.format).channels;
+        const int width=97+2*(int)(Rng()%16), height=ImageHeight(width,f.format);
+        std::vector<unsigned char> bufferA, bufferB;
+        const Image a=LocalImage(bufferA,width,height,2,f.format), b=LocalImage(bufferB,width,height,2,f.format);
+        for (unsigned char& c : bufferA) c=(unsigned char)Rng();
+        for (unsigned char& c : bufferB) c=(unsigned char)Rng();
+        for (int way=0; way<3; way++) {
+            const std::string type=f.name+std::string(ways[way]);
+            const unsigned int threads=(way==0)?1:3;
+            std::vector<unsigned char> out[5];
+            Image images[5];
+            for (int k=0; k<5; k++) {
+                out[k]=bufferA;
+                images[k]=a;
+                images[k].data=out[k].data();
+            }
+            if (way<2) {
+                RaylibOps::AddImage(images[0],b,threads);
+                RaylibOps::SubtractImage(images[1],b,threads);
+                RaylibOps::ScaleImage(images[3],s,threads);
+                if (channels>=3) RaylibOps::TintImage(images[4],tint,threads);
+            }
+            else {
+                images[0]+=b;
+                images[1]-=b;
+                images[3]*=s;
+                if (channels>=3) images[4]*=tint;
+            }
+            RaylibOps::DifferenceImage(images[2],b,(way<2)?threads:0);
+            for (std::size_t i=0; i<bufferA.size(); i+=(std::size_t)channels) {
+                Color pa=PixelColor(&bufferA[i],channels), pb=PixelColor(&bufferB[i],channels);
+                Expect(type.c_str(),"a+=b",PixelColor(&out[0][i],channels),ReferenceColor(pa,pb,ReferenceAdd),pa,pb);
+                Expect(type.c_str(),"a-=b",PixelColor(&out[1][i],channels),ReferenceColor(pa,pb,ReferenceSubtract),pa,pb);
+                Expect(type.c_str(),"DifferenceImage()",PixelColor(&out[2][i],channels),ReferenceColor(pa,pb,ReferenceDifference),pa,pb);
+                Expect(type.c_str(),"a*=float",PixelColor(&out[3][i],channels),ReferenceScale(pa,s),pa,s);
+                if (channels<3) continue;
+                Color want=ReferenceColor(pa,tint,ReferenceMultiply);
+                if (channels==3) want.a=0;
+                Expect(type.c_str(),"a*=tint",PixelColor(&out[4][i],channels),want,pa,tint);
+            }
+        }
+    }
+    for (const Format& f : floatFormats) {
+        const float s=RandomFloat();
+        const int channels=RaylibOps::PixelFormatLookup(f.format).channels;
+        const int width=97+2*(int)(Rng()%16), height=ImageHeight(width,f.format);
+        std::vector<float> bufferA, bufferB;
+        const Image a=LocalImage(bufferA,width,height,2,f.format), b=LocalImage(bufferB,width,height,2,f.format);
+        for (float& x : bufferA) x=RandomFloat();
+        for (float& x : bufferB) x=RandomFloat();
+        const float scale[4]={tint.r/255.0f,tint.g/255.0f,tint.b/255.0f,tint.a/255.0f};
+        for (int way=0; way<3; way++) {
+            const std::string type=f.name+std::string(ways[way]);
+            const unsigned int threads=(way==0)?1:3;
+            std::vector<float> out[5];
+            Image images[5];
+            for (int k=0; k<5; k++) {
+                out[k]=bufferA;
+                images[k]=a;
+                images[k].data=out[k].data();
+            }
+            if (way<2) {
+                RaylibOps::AddImage(images[0],b,threads);
+                RaylibOps::SubtractImage(images[1],b,threads);
+                RaylibOps::ScaleImage(images[3],s,threads);
+                if (channels>=3) RaylibOps::TintImage(images[4],tint,threads);
+            }
+            else {
+                images[0]+=b;
+                images[1]-=b;
+                images[3]*=s;
+                if (channels>=3) images[4]*=tint;
+            }
+            RaylibOps::DifferenceImage(images[2],b,(way<2)?threads:0);
+            for (std::size_t i=0; i<bufferA.size(); i++) {
+                float x=bufferA[i], y=bufferB[i];
+                Expect(type.c_str(),"a+=b",out[0][i],x+y,x,y);
+                Expect(type.c_str(),"a-=b",out[1][i],x-y,x,y);
+                Expect(type.c_str(),"DifferenceImage()",out[2][i],std::fabs(x-y),x,y);
+                Expect(type.c_str(),"a*=float",out[3][i],x*s,x,s);
+                if (channels>=3) Expect(type.c_str(),"a*=tint",out[4][i],x*scale[i%channels],x,tint);
+            }
+        }
+    }
+
+    //Packed formats, images of different sizes and tinting a single channel throw
+    std::vector<unsigned char> packed, square, taller, gray;
+    Image r5g6b5=LocalImage(packed,4,4,1,PIXELFORMAT_UNCOMPRESSED_R5G6B5);
+    Image a=LocalImage(square,4,4,1,PIXELFORMAT_UNCOMPRESSED_R8G8B8A8), b=LocalImage(taller,4,5,1,PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    Image grayscale=LocalImage(gray,4,4,1,PIXELFORMAT_UNCOMPRESSED_GRAYSCALE);
+    ExpectThrows("Image","R5G6B5+=R5G6B5",[&] { r5g6b5+=r5g6b5; });
+    ExpectThrows("Image","R5G6B5-=R5G6B5",[&] { r5g6b5-=r5g6b5; });
+    ExpectThrows("Image","R5G6B5*=float",[&] { r5g6b5*=2.0f; });
+    ExpectThrows("Image","R5G6B5*=tint",[&] { r5g6b5*=tint; });
+    ExpectThrows("Image","4x4+=4x5",[&] { a+=b; });
+    ExpectThrows("Image","4x4-=4x5",[&] { a-=b; });
+    ExpectThrows("Image","DifferenceImage() of 4x4 and 4x5",[&] { RaylibOps::DifferenceImage(a,b); });
+    ExpectThrows("Image","RGBA+=GRAYSCALE",[&] { a+=grayscale; });
+    ExpectThrows("Image","GRAYSCALE*=tint",[&] { grayscale*=tint; });
+}
+
+//The stored vector nearest to v among those equal to it, found by checking every one, or npos
+template<typename Tolerance, typename V> std::size_t NearestEqual(const std::vector<V>& stored, const V& v, float& distance) {
+    std::size_t best=RaylibOps::HashGrid<V,Tolerance>::npos;
+    for (std::size_t i=0; i<stored.size(); i++) {
+        if (!RaylibOps::ApproximatelyEqual<Tolerance>(stored[i],v)) continue;
+        float d=0.0f;
+        for (int c=0; c<RaylibOps::VectorTraits<V>::Dimension; c++) {
+            float x=stored[i].*RaylibOps::VectorTraits<V>::Components[c], y=v.*RaylibOps::VectorTraits<V>::Components[c];
+            float e=(x==y)?0.0f:x-y;
+            d+=e*e;
+        }
+        if (best==RaylibOps::HashGrid<V,Tolerance>::npos || d<distance) { best=i; distance=d; }
+    }
+return best;
+}
+
+//Weld() against welding by brute force.  Which of two equally near vectors a vertex is mapped to may differ, so the distance is compared, not the index.
+template<typename V, typename Tolerance> void FuzzWeld(const char* type, std::size_t cases) {
+    std::size_t n=cases/16+Rng()%17;
+    std::vector<V> v(n);
+    for (std::size_t i=0; i<n; i++) v[i]=(i>0 && Rng()%2==0)?Nearby(v[Rng()%i]):Random<V>();
+    std::vector<std::size_t> remap;
+    std::vector<V> welded=RaylibOps::Weld<Tolerance>(v.data(),n,remap);
+    std::vector<V> want;
+    for (std::size_t i=0; i<n; i++) {
+        float distance=0.0f;
+        std::size_t j=NearestEqual<Tolerance>(want,v[i],distance);
+        if (j==RaylibOps::HashGrid<V,Tolerance>::npos) {
+            want.push_back(v[i]);
+            Expect(type,"Weld() adds a vector with no equal",remap[i]==want.size()-1,true,v[i]);
+            continue;
+        }
+        float got=distance+1.0f;
+        bool found=remap[i]<want.size() && NearestEqual<Tolerance>(std::vector<V>(1,want[remap[i]]),v[i],got)==0;
+        Expect(type,"Weld() maps to an equal vector",found,true,v[i],want[j]);
+        if (found) Expect(type,"Weld() maps to the nearest equal vector",got,distance,v[i],want[j]);
+    }
+    Expect(type,"Weld() count",welded.size()==want.size(),true);
+    for (std::size_t i=0; i<welded.size() && i<want.size(); i++) Expect(type,"Weld()",welded[i],want[i]);
+}
+
+//Where a ray CheckCollisionRayBox() says hits box first meets it, written out as raylib computes its slabs: the last entry into one, or 0 from inside
+float ReferenceBoxDistance(const Ray& r, const BoundingBox& b) {
+    float t[6]={(b.min.x-r.position.x)/r.direction.x, (b.max.x-r.position.x)/r.direction.x, (b.min.y-r.position.y)/r.direction.y,
+                (b.max.y-r.position.y)/r.direction.y, (b.min.z-r.position.z)/r.direction.z, (b.max.z-r.position.z)/r.direction.z};
+    float entry=(float)std::fmax(std::fmax(std::fmin(t[0],t[1]),std::fmin(t[2],t[3])),std::fmin(t[4],t[5]));
+return (entry>0.0f)?entry:0.0f;
+}
+
+//CastRays() with boxes against CheckCollisionRayBox() on every box.  Integer corners and origins with directions of 0, +-0.5, +-1 and +-2 keep every step exact,
+//and start many rays on the plane of a face or of a flat box, parallel to it.  Which of two equally near boxes is hit may differ, so the distance is compared, not the index.
+void FuzzCastRays(std::size_t cases) {
+    const float steps[]={0.0f, -0.0f, 0.5f, -0.5f, 1.0f, -1.0f, 2.0f, -2.0f};
+    std::size_t n=cases/64+Rng()%17, count=cases/16+Rng()%17;
+    std::vector<BoundingBox> boxes(n);
+    for (BoundingBox& b : boxes) {
+        b.min=Vector3{(float)RandomInt(4), (float)RandomInt(4), (float)RandomInt(4)};
+        b.max=Vector3{b.min.x+(float)(Rng()%3), b.min.y+(float)(Rng()%3), b.min.z+(float)(Rng()%3)};
+    }
+    std::vector<Ray> rays(count);
+    for (Ray& r : rays) {
+        r.position=Vector3{(float)RandomInt(5), (float)RandomInt(5), (float)RandomInt(5)};
+        do r.direction=Vector3{steps[Rng()%8], steps[Rng()%8], steps[Rng()%8]};
+        while (r.direction.x==0.0f && r.direction.y==0.0f && r.direction.z==0.0f);
+    }
+    const RaylibOps::RayPacket packet(rays);
+    std::vector<RayHitInfo> hits(count);
+    std::vector<std::size_t> index(count);
+    for (unsigned int threads : {1u, 3u}) {
+        RaylibOps::CastRays(packet,boxes.data(),n,hits.data(),index.data(),threads);
+        for (std::size_t i=0; i<count; i++) {
+            bool hit=false;
+            float distance=std::numeric_limits<float>::infinity();
+            for (std::size_t j=0; j<n; j++) {
+                if (!CheckCollisionRayBox(rays[i],boxes[j])) continue;
+                hit=true;
+                distance=std::min(distance,ReferenceBoxDistance(rays[i],boxes[j]));
+            }
+            Expect("RayPacket","CastRays() hit",hits[i].hit,hit,rays[i]);
+            if (!hit || !hits[i].hit) continue;
+            Expect("RayPacket","CastRays() hits a box CheckCollisionRayBox() hits",index[i]<n && CheckCollisionRayBox(rays[i],boxes[index[i]]),true,rays[i]);
+            Expect("RayPacket","CastRays() distance",hits[i].distance,distance,rays[i]);
+        }
+    }
+}
+
+//Whether the frustum of the view-projection matrix m culls b, from b's eight corners in clip space: it does if all of them lie outside one of the planes
+//-w<=x, y, z<=w.  -1 if a corner lies within margin of a plane, where rounding may go either way.
+int ReferenceCulled(const Matrix& m, const BoundingBox& b, double margin) {
+    bool close=false;
+    for (int plane=0; plane<6; plane++) {
+        double furthest=-std::numeric_limits<double>::infinity(), sign=(plane%2==0)?1.0:-1.0;
+        for (int corner=0; corner<8; corner++) {
+            double x=(corner&1)?b.max.x:b.min.x, y=(corner&2)?b.max.y:b.min.y, z=(corner&4)?b.max.z:b.min.z;
+            double clip[4]={m.m0*x+m.m4*y+m.m8*z+m.m12, m.m1*x+m.m5*y+m.m9*z+m.m13, m.m2*x+m.m6*y+m.m10*z+m.m14, m.m3*x+m.m7*y+m.m11*z+m.m15};
+            furthest=std::max(furthest,clip[3]+sign*clip[plane/2]);
+        }
+        if (furthest<-margin) return 1;
+        if (furthest<margin) close=true;
+    }
+return close?-1:0;
+}
+
+//OverlapMask() of a box against CheckCollisionBoxes() on integer boxes, touching faces included, and of a Frustum against the corners of each box in clip space,
+//for perspective and orthographic cameras.  The BoxArray overload must give the same bits with 1 and 3 threads as the overload on a plain array.
+void FuzzOverlapMask() {
+    const std::size_t n=2*RaylibOps::ParallelMinimum+1+Rng()%63;
+    std::vector<BoundingBox> boxes(n);
+    for (BoundingBox& b : boxes) b=IntegerBox(4,3);
+    RaylibOps::BoxArray array(boxes);
+    for (int round=0; round<4; round++) {
+        const BoundingBox query=IntegerBox(4,3);
+        const RaylibOps::BitMask plain=RaylibOps::OverlapMask(query,boxes.data(),n), one=RaylibOps::OverlapMask(query,array,1), three=RaylibOps::OverlapMask(query,array,3);
+        for (std::size_t i=0; i<n; i++) {
+            Expect("BoxArray","OverlapMask(box)",plain[i],CheckCollisionBoxes(query,boxes[i]),query,boxes[i]);
+            Expect("BoxArray","OverlapMask(box) of a BoxArray",one[i],plain[i],query,boxes[i]);
+            Expect("BoxArray","OverlapMask(box) with 3 threads",three[i],plain[i],query,boxes[i]);
+        }
+    }
+
+    for (BoundingBox& b : boxes) b=IntegerBox(16,5);
+    array=RaylibOps::BoxArray(boxes);
+    for (int round=0; round<4; round++) {
+        Vector3 eye{(float)RandomInt(8), (float)RandomInt(8), (float)RandomInt(8)}, target;
+        do target=Vector3{eye.x+(float)RandomInt(4), eye.y+(float)RandomInt(4), eye.z+(float)RandomInt(4)};
+        while (target.x==eye.x && target.z==eye.z);
+        const Matrix view=MatrixLookAt(eye,target,Vector3{0.0f,1.0f,0.0f});
+        const Matrix projection=(round%2==0)?MatrixPerspective((30.0+30.0*(Rng()%3))*PI/180.0,(Rng()%2==0)?1.0:16.0/9.0,0.5,30.0):MatrixOrtho(-8.0,8.0,-6.0,6.0,0.5,30.0);
+        const Matrix viewProjection=MatrixMultiply(view,projection);
+        const RaylibOps::Frustum frustum=RaylibOps::Frustum::FromMatrix(viewProjection);
+        const RaylibOps::BitMask plain=RaylibOps::OverlapMask(frustum,boxes.data(),n), one=RaylibOps::OverlapMask(frustum,array,1), three=RaylibOps::OverlapMask(frustum,array,3);
+        for (std::size_t i=0; i<n; i++) {
+            int culled=ReferenceCulled(viewProjection,boxes[i],1e-3);
+            if (culled>=0) Expect("Frustum","OverlapMask(frustum)",plain[i],culled==0,eye,target,boxes[i]);
+            Expect("Frustum","OverlapMask(frustum) of a BoxArray",one[i],plain[i],eye,target,boxes[i]);
+            Expect("Frustum","OverlapMask(frustum) with 3 threads",three[i],plain[i],eye,target,boxes[i]);
+        }
+    }
+}
+
+//A copy of the camera with one of its floats, in the order they are declared, moved by one ulp
+template<typename Camera, int Floats> Camera Nudged(const Camera& c, int k) {
+    float f[Floats];
+    std::memcpy(f,&c,sizeof f);
+    f[k]=std::nextafter(f[k],std::numeric_limits<float>::infinity());
+    Camera moved=c;
+    std::memcpy(&moved,f,sizeof f);
+return moved;
+}
+
+template<typename T> std::string Printed(const T& t) {
+    std::ostringstream os;
+    os<<t;
+return os.str();
+}
+
+//Update() of a CameraSnapshot and a CameraSnapshot2D with the camera they hold returns false and leaves every matrix as it was.  Moving any field of the camera
+//by an ulp, switching the projection, or setting the aspect ratio or clip planes makes it recompute them, and View() is then GetCameraMatrix() or
+//GetCameraMatrix2D() of the new camera.  A snapshot prints the same text as its camera.
+void FuzzCameraSnapshot(std::size_t cases) {
+    for (std::size_t i=0; i<cases/64+1; i++) {
+        Camera3D camera;
+        camera.position=Vector3{(float)RandomInt(100), (float)RandomInt(100), (float)RandomInt(100)};
+        camera.target=Vector3{(float)RandomInt(100), (float)RandomInt(100), (float)RandomInt(100)};
+        camera.up=Vector3{(float)RandomInt(2), 1.0f, (float)RandomInt(2)};
+        camera.fovy=(float)(10+Rng()%110);
+        camera.projection=(Rng()%2==0)?CAMERA_PERSPECTIVE:CAMERA_ORTHOGRAPHIC;
+        RaylibOps::CameraSnapshot snapshot((Rng()%2==0)?1.0f:16.0f/9.0f);
+        Expect("CameraSnapshot","first Update()",snapshot.Update(camera),true,camera);
+        Expect("CameraSnapshot","View()",snapshot.View(),GetCameraMatrix(camera),camera);
+        Expect("CameraSnapshot","ViewProjection()",snapshot.ViewProjection(),MatrixMultiply(snapshot.View(),snapshot.Projection()),camera);
+        Expect("CameraSnapshot","ViewFrustum()",snapshot.ViewFrustum(),RaylibOps::Frustum::FromMatrix(snapshot.ViewProjection()),camera);
+        Expect("CameraSnapshot","operator<<",Printed(snapshot),Printed(camera),camera);
+
+        const Matrix view=snapshot.View(), projection=snapshot.Projection(), viewProjection=snapshot.ViewProjection();
+        Expect("CameraSnapshot","Update() with the same camera",snapshot.Update(camera),false,camera);
+        Expect("CameraSnapshot","Changed() with the same camera",snapshot.Changed(),false,camera);
+        Expect("CameraSnapshot","View() with the same camera",snapshot.View(),view,camera);
+        Expect("CameraSnapshot","Projection() with the same camera",snapshot.Projection(),projection,camera);
+        Expect("CameraSnapshot","ViewProjection() with the same camera",snapshot.ViewProjection(),viewProjection,camera);
+
+        for (int k=0; k<10; k++) {  //position, target, up and fovy
+            const Camera3D moved=Nudged<Camera3D,10>(camera,k);
+            Expect("CameraSnapshot","Update() with a camera moved",snapshot.Update(moved),true,moved);
+            Expect("CameraSnapshot","Changed() with a camera moved",snapshot.Changed(),true,moved);
+            Expect("CameraSnapshot","GetCamera() with a camera moved",RaylibOps::SameCamera(snapshot.GetCamera(),moved),true,moved);
+            Expect("CameraSnapshot","View() with a camera moved",snapshot.View(),GetCameraMatrix(moved),moved);
+            Expect("CameraSnapshot","operator<< with a camera moved",Printed(snapshot),Printed(moved),moved);
+            snapshot.Update(camera);
+        }
+        Camera3D switched=camera;
+        switched.projection=(camera.projection==CAMERA_PERSPECTIVE)?CAMERA_ORTHOGRAPHIC:CAMERA_PERSPECTIVE;
+        Expect("CameraSnapshot","Update() with the projection switched",snapshot.Update(switched),true,camera);
+        Expect("CameraSnapshot","Projection() with the projection switched",Same(snapshot.Projection(),projection),false,camera);
+        Expect("CameraSnapshot","operator<< with the projection switched",Printed(snapshot),Printed(switched),camera);
+        snapshot.Update(camera);
+        Expect("CameraSnapshot","Projection() switched back",snapshot.Projection(),projection,camera);
+        snapshot.SetAspect(2.0f);
+        Expect("CameraSnapshot","Update() after SetAspect()",snapshot.Update(camera),true,camera);
+        snapshot.SetClipPlanes(0.5f,50.0f);
+        Expect("CameraSnapshot","Update() after SetClipPlanes()",snapshot.Update(camera),true,camera);
+        Expect("CameraSnapshot","Update() after that",snapshot.Update(camera),false,camera);
+
+        Camera2D camera2D{Vector2{(float)RandomInt(500), (float)RandomInt(500)}, Vector2{(float)RandomInt(500), (float)RandomInt(500)}, (float)RandomInt(180), (float)(1+Rng()%8)/4.0f};
+        RaylibOps::CameraSnapshot2D snapshot2D;
+        Expect("CameraSnapshot2D","first Update()",snapshot2D.Update(camera2D),true,camera2D);
+        Expect("CameraSnapshot2D","View()",snapshot2D.View(),GetCameraMatrix2D(camera2D),camera2D);
+        Expect("CameraSnapshot2D","operator<<",Printed(snapshot2D),Printed(camera2D),camera2D);
+        const Matrix view2D=snapshot2D.View();
+        Expect("CameraSnapshot2D","Update() with the same camera",snapshot2D.Update(camera2D),false,camera2D);
+        Expect("CameraSnapshot2D","Changed() with the same camera",snapshot2D.Changed(),false,camera2D);
+        Expect("CameraSnapshot2D","View() with the same camera",snapshot2D.View(),view2D,camera2D);
+        for (int k=0; k<6; k++) {  //offset, target, rotation and zoom
+            const Camera2D moved=Nudged<Camera2D,6>(camera2D,k);
+            Expect("CameraSnapshot2D","Update() with a camera moved",snapshot2D.Update(moved),true,moved);
+            Expect("CameraSnapshot2D","Changed() with a camera moved",snapshot2D.Changed(),true,moved);
+            Expect("CameraSnapshot2D","View() with a camera moved",snapshot2D.View(),GetCameraMatrix2D(moved),moved);
+            Expect("CameraSnapshot2D","operator<< with a camera moved",Printed(snapshot2D),Printed(moved),moved);
+            snapshot2D.Update(camera2D);
+        }
+    }
+}
+
+//A float of RandomFloat() other than NaN and -0, whose minimum and maximum do not depend on the instruction set
+float OrderedFloat() {
+    float f=RandomFloat();
+return (f!=f || f==0.0f)?0.0f:f;
+}
+
+//Sum() and Mean() of span of V with threads 1 and 3, bit for bit, on a span long enough to be split and not a whole number of ReduceBlocks
+template<typename V> void ExpectSameForThreads(const char* type, const std::vector<V>& points, RaylibOps::Summation mode) {
+    const RaylibOps::VectorArray<V> lanes(points);
+    Expect(type,"Sum() with 3 threads",RaylibOps::Sum(points.data(),points.size(),mode,3),RaylibOps::Sum(points.data(),points.size(),mode,1));
+    Expect(type,"Mean() with 3 threads",RaylibOps::Mean(points.data(),points.size(),mode,3),RaylibOps::Mean(points.data(),points.size(),mode,1));
+    Expect(type,"Sum() of an array with 3 threads",RaylibOps::Sum(lanes,mode,3),RaylibOps::Sum(lanes,mode,1));
+    Expect(type,"Mean() of an array with 3 threads",RaylibOps::Mean(lanes,mode,3),RaylibOps::Mean(lanes,mode,1));
+}
+
+//Sum() and Mean() give the same bits for any thread count.  Summation::Compensated stays within an ulp of the double sum, both of points near 1000 and of
+//integers up to 2^23 which cancel: their running sums pass 2^24, where float addition rounds, but every Kahan correction is a whole number and exact.  ComponentMin(), ComponentMax() and Bounds() match a loop of std::min and std::max.  No points have a zero
+//sum and mean and an inverted bounding box from +infinity to -infinity.
+void FuzzReductions() {
+    const std::size_t n=2*RaylibOps::ParallelMinimum+1+Rng()%(RaylibOps::ReduceBlock-1);
+    std::vector<Vector3> cancelling(n);
+    for (std::size_t i=0; i<n; i+=2) {
+        cancelling[i]=Vector3{(float)RandomInt(1<<23), (float)RandomInt(1<<23), (float)RandomInt(1<<23)};
+        if (i+1<n) cancelling[i+1]=Vector3{RandomInt(8)-cancelling[i].x, RandomInt(8)-cancelling[i].y, -cancelling[i].z};
+    }
+    for (RaylibOps::Summation mode : {RaylibOps::Summation::Fast, RaylibOps::Summation::Compensated}) {
+        ExpectSameForThreads("Vector2",ModerateVector<Vector2>(n),mode);
+        ExpectSameForThreads("Vector3",ModerateVector<Vector3>(n),mode);
+        ExpectSameForThreads("Vector3",cancelling,mode);
+    }
+    std::vector<Vector4> quads=ModerateVector<Vector4>(n);
+    Expect("Vector4","Sum() with 3 threads",RaylibOps::Sum(quads.data(),n,RaylibOps::Summation::Fast,3),RaylibOps::Sum(quads.data(),n,RaylibOps::Summation::Fast,1));
+
+    std::vector<Vector3> near(n);
+    std::uniform_real_distribution<float> thousand(999.0f,1001.0f);
+    for (Vector3& v : near) v=Vector3{thousand(Rng), -thousand(Rng), thousand(Rng)};
+    for (const std::vector<Vector3>* points : {&near, &cancelling}) {
+        double exact[3]={0.0, 0.0, 0.0};
+        for (const Vector3& v : *points) {
+            exact[0]+=v.x;
+            exact[1]+=v.y;
+            exact[2]+=v.z;
+        }
+        const Vector3 want{(float)exact[0], (float)exact[1], (float)exact[2]};
+        const Vector3 sums[]={RaylibOps::Sum(points->data(),n,RaylibOps::Summation::Compensated,3), RaylibOps::Sum(RaylibOps::Vector3Array(*points),RaylibOps::Summation::Compensated,3)};
+        for (const Vector3& sum : sums) {
+            const float got[3]={sum.x, sum.y, sum.z};
+            for (int k=0; k<3; k++) {
+                float rounded=std::fabs((float)exact[k]);
+                bool close=std::fabs(got[k]-exact[k])<=std::nextafter(rounded,FLT_MAX)-rounded;
+                Expect("Vector3","Sum() with Summation::Compensated within an ulp of the double sum",close,true,sum,want);
+            }
+        }
+    }
+
+    std::vector<Vector3> cloud(n);
+    for (Vector3& v : cloud) v=Vector3{OrderedFloat(), OrderedFloat(), OrderedFloat()};
+    std::vector<Vector2> flat(n);
+    for (Vector2& v : flat) v=Vector2{OrderedFloat(), OrderedFloat()};
+    const float infinity=std::numeric_limits<float>::infinity();
+    BoundingBox box{{infinity,infinity,infinity},{-infinity,-infinity,-infinity}};
+    for (const Vector3& v : cloud) {
+        box.min=Vector3{std::min(box.min.x,v.x), std::min(box.min.y,v.y), std::min(box.min.z,v.z)};
+        box.max=Vector3{std::max(box.max.x,v.x), std::max(box.max.y,v.y), std::max(box.max.z,v.z)};
+    }
+    Vector2 low{infinity,infinity}, high{-infinity,-infinity};
+    for (const Vector2& v : flat) {
+        low=Vector2{std::min(low.x,v.x), std::min(low.y,v.y)};
+        high=Vector2{std::max(high.x,v.x), std::max(high.y,v.y)};
+    }
+    const Rectangle rectangle{low.x,low.y,high.x-low.x,high.y-low.y};
+    for (unsigned int threads : {1u, 3u}) {
+        Expect("Vector3","Bounds()",RaylibOps::Bounds(cloud.data(),n,threads),box);
+        Expect("Vector3Array","Bounds()",RaylibOps::Bounds(RaylibOps::Vector3Array(cloud),threads),box);
+        Expect("Vector3","ComponentMin()",RaylibOps::ComponentMin(cloud.data(),n,threads),box.min);
+        Expect("Vector3","ComponentMax()",RaylibOps::ComponentMax(cloud.data(),n,threads),box.max);
+        Expect("Vector2","Bounds()",RaylibOps::Bounds(flat.data(),n,threads),rectangle);
+        Expect("Vector2Array","Bounds()",RaylibOps::Bounds(RaylibOps::Vector2Array(flat),threads),rectangle);
+    }
+
+    const std::vector<Vector3> none;
+    const BoundingBox inverted{{infinity,infinity,infinity},{-infinity,-infinity,-infinity}};
+    Expect("Vector3","Sum() of no points",RaylibOps::Sum(none.data(),0),Vector3{0.0f,0.0f,0.0f});
+    Expect("Vector3","Mean() of no points",RaylibOps::Mean(none.data(),0),Vector3{0.0f,0.0f,0.0f});
+    Expect("Vector3Array","Mean() of no points",RaylibOps::Mean(RaylibOps::Vector3Array()),Vector3{0.0f,0.0f,0.0f});
+    Expect("Vector3","Bounds() of no points",RaylibOps::Bounds(none.data(),0),inverted);
+    Expect("Vector3Array","Bounds() of no points",RaylibOps::Bounds(RaylibOps::Vector3Array()),inverted);
+    Expect("Vector3","Bounds() of no points is empty",RaylibOps::IsEmpty(RaylibOps::Bounds(none.data(),0)),true);
+    Expect("Vector2","Bounds() of no points",RaylibOps::Bounds(static_cast<const Vector2*>(nullptr),0),Rectangle{0.0f,0.0f,0.0f,0.0f});
+}
+
+//sRGB to linear and back, as IEC 61966-2-1 writes it, with pow()
+double ReferenceSrgbDecode(double c) { return (c<=0.04045)?c/12.92:std::pow((c+0.055)/1.055,2.4); }
+
+unsigned char ReferenceSrgbEncode(float x) {
+    double c=(x<=0.0031308)?12.92*x:1.055*std::pow((double)x,1.0/2.4)-0.055;
+return (unsigned char)std::floor(c*255.0+0.5);
+}
+
+//LinearColor against the sRGB formulas: every code decodes to within 1e-6 of it and round-trips, random values in 0..1 encode to the nearest code,
+//anything out of range or NaN clamps, and ToLinear() and ToSrgb() on a span split between threads give what converting one color at a time does.
+void FuzzLinearColor(std::size_t cases) {
+    for (int k=0; k<256; k++) {
+        unsigned char c=(unsigned char)k;
+        Expect("LinearColor","SrgbToLinear() within 1e-6 of the sRGB formula",std::fabs(RaylibOps::SrgbToLinear(c)-ReferenceSrgbDecode(k/255.0))<=1e-6,true,Color{c,c,c,c});
+        const Color color{c, (unsigned char)(255-k), (unsigned char)(k^0x5A), c};
+        Expect("LinearColor","round trip",(Color)RaylibOps::LinearColor(color),color,color);
+    }
+    for (std::size_t i=0; i<cases; i++) {
+        float x=std::uniform_real_distribution<float>(0.0f,1.0f)(Rng);
+        Expect("LinearColor","LinearToSrgb() rounds to the nearest code",RaylibOps::LinearToSrgb(x)==ReferenceSrgbEncode(x),true,x);
+    }
+    const float infinity=std::numeric_limits<float>::infinity(), nan=std::numeric_limits<float>::quiet_NaN();
+    for (float low : {-0.0f, -1.0f, -infinity, nan, 1e-30f}) {
+        Expect("LinearColor","LinearToSrgb() clamps to 0",RaylibOps::LinearToSrgb(low)==0,true,low);
+        Expect("LinearColor","LinearToAlpha() clamps to 0",RaylibOps::LinearToAlpha(low)==0,true,low);
+    }
+    for (float high : {1.0f, 1.5f, 1e30f, infinity}) {
+        Expect("LinearColor","LinearToSrgb() clamps to 255",RaylibOps::LinearToSrgb(high)==255,true,high);
+        Expect("LinearColor","LinearToAlpha() clamps to 255",RaylibOps::LinearToAlpha(high)==255,true,high);
+    }
+    Expect("LinearColor","Color() of out of range values",(Color)RaylibOps::LinearColor(-0.5f,nan,2.0f,infinity),Color{0,0,255,255});
+
+    const std::size_t n=2*RaylibOps::ParallelMinimum+Rng()%1000;
+    std::vector<Color> colors(n), back(n);
+    std::vector<RaylibOps::LinearColor> linear(n), lit(n);
+    for (Color& c : colors) Randomize(c);
+    for (RaylibOps::LinearColor& l : lit) l=RaylibOps::LinearColor(OrderedFloat(),OrderedFloat(),std::uniform_real_distribution<float>(-0.1f,1.1f)(Rng),RandomFloat());
+    RaylibOps::ToLinear(colors.data(),linear.data(),n,3);
+    RaylibOps::ToSrgb(lit.data(),back.data(),n,3);
+    for (std::size_t i=0; i<n; i++) {
+        Expect("LinearColor","ToLinear() with 3 threads",linear[i],RaylibOps::LinearColor(colors[i]),colors[i]);
+        Expect("LinearColor","ToSrgb() with 3 threads",back[i],(Color)lit[i],lit[i]);
+    }
+}
+
+//The lines of text, sorted
+std::vector<std::string> SortedLines(const std::string& text) {
+    std::vector<std::string> lines;
+    std::istringstream in(text);
+    for (std::string line; std::getline(in,line);) lines.push_back(line);
+    std::sort(lines.begin(),lines.end());
+return lines;
+}
+
+//Eight threads posting into one small AsyncLog at once.  With LogOverflow::Block every post is written, with Drop every post is written or dropped, and either way
+//Flush() returns only once all of them are written and each line is one that was posted.  The destructor writes what was posted without a Flush().
+void FuzzAsyncLog(std::size_t cases) {
+    const unsigned int producers=8;
+    const std::size_t posts=cases/16+Rng()%17;
+    std::ostringstream expected;
+    for (unsigned int t=0; t<producers; t++) {
+        for (std::size_t i=0; i<posts; i++) {
+            if (i%3==0) expected<<"tick\n";
+            else expected<<"v: "<<Vector3{(float)t,(float)i,-1.0f}<<"\n";
+        }
+    }
+    const std::vector<std::string> want=SortedLines(expected.str());
+    for (RaylibOps::LogOverflow overflow : {RaylibOps::LogOverflow::Block, RaylibOps::LogOverflow::Drop}) {
+        const char* type=(overflow==RaylibOps::LogOverflow::Block)?"AsyncLog blocking":"AsyncLog dropping";
+        std::ostringstream text;
+        RaylibOps::AsyncLog log(text,64,overflow);
+        std::vector<std::thread> threads;
+        for (unsigned int t=0; t<producers; t++) {
+            threads.emplace_back([&log,posts,t] {
+                for (std::size_t i=0; i<posts; i++) {
+                    if (i%3==0) log.Post("tick");
+                    else log.Post("v",Vector3{(float)t,(float)i,-1.0f});
+                }
+            });
+        }
+        for (std::thread& t : threads) t.join();
+        log.Flush();
+        std::vector<std::string> got=SortedLines(text.str());
+        Expect(type,"Flush() writes every post",log.Written()+log.Dropped()==producers*posts && got.size()==log.Written(),true);
+        if (overflow==RaylibOps::LogOverflow::Block) {
+            Expect(type,"drops nothing",log.Dropped()==0,true);
+            Expect(type,"writes each post once",got==want,true);
+        }
+        else Expect(type,"writes only posted lines",std::includes(want.begin(),want.end(),got.begin(),got.end()),true);
+    }
+    std::ostringstream text;
+    {
+        RaylibOps::AsyncLog log(text,64,RaylibOps::LogOverflow::Block);
+        for (std::size_t i=0; i<posts; i++) log.Post("tick");
+    }
+    Expect("AsyncLog","destructor writes every post",SortedLines(text.str()).size()==posts,true);
+}
+
+// ********************************************
+//
+//    Output
+//
+// ********************************************
+//
+// Each type as the original overloads printed it, one insertion per piece
+
+#ifdef PRINT_VECTORS_WITH_PARENTHESES
+void Insert(std::ostream& os, const Vector2& a) { os<<"("<<a.x<<","<<a.y<<")"; }
+void Insert(std::ostream& os, const Vector3& a) { os<<"("<<a.x<<","<<a.y<<","<<a.z<<")"; }
+void Insert(std::ostream& os, const Vector4& a) { os<<"("<<a.x<<","<<a.y<<","<<a.z<<","<<a.w<<")"; }
+void Insert(std::ostream& os, const Color& c) { os<<"("<<(unsigned int)c.r<<","<<(unsigned int)c.g<<","<<(unsigned int)c.b<<","<<(unsigned int)c.a<<")"; }
+#else
+void Insert(std::ostream& os, const Vector2& a) { os<<"x="<<a.x<<", y="<<a.y; }
+void Insert(std::ostream& os, const Vector3& a) { os<<"x="<<a.x<<", y="<<a.y<<", z="<<a.z; }
+void Insert(std::ostream& os, const Vector4& a) { os<<"x="<<a.x<<", y="<<a.y<<", z="<<a.z<<", w="<<a.w; }
+void Insert(std::ostream& os, const Color& c) { os<<"R="<<(unsigned int)c.r<<" G="<<(unsigned int)c.g<<" B="<<(unsigned int)c.b<<" A="<<(unsigned int)c.a; }
+#endif
+
+void Insert(std::ostream& os, const Matrix& m) {
+    os<<" \t"<<m.m0<< "\t"<<m.m4<<" \t"<<m.m8<<" \t"<<m.m12<<"\n";
+    os<<" \t"<<m.m1<< "\t"<<m.m5<<" \t"<<m.m9<<" \t"<<m.m13<<"\n";
+    os<<" \t"<<m.m2<< "\t"<<m.m6<<" \t"<<m.m10<<" \t"<<m.m14<<"\n";
+    os<<" \t"<<m.m3<< "\t"<<m.m7<<" \t"<<m.m11<<" \t"<<m.m15<<"\n";
+}
+
+void Insert(std::ostream& os, const Rectangle& r) { os<<"Rectangle corner: ("<<r.x<<","<<r.y<<"), Width="<<r.width<<"Height="<<r.height; }
+
+void Insert(std::ostream& os, const Image& i) {
+    os<<"Image width="<<i.width<<" Height="<<i.height<<" Mipmap levels="<<i.mipmaps<<" PixelFormat number:"<<i.format<<" type: "<<PixelFormatNumberToName(i.format)<<" ";
+}
+
+void Insert(std::ostream& os, const Texture& t) {
+    os<<"Texture ID#: "<<t.id<<" Width="<<t.width<<" Height="<<t.height<<" Mipmap levels="<<t.mipmaps<<" PixelFormat number:"<<t.format<<" type: "<<PixelFormatNumberToName(t.format)<<" ";
+}
+
+void Insert(std::ostream& os, const Camera2D& c) {
+    os<<"** 2D Camera info. **\nOffset: ";
+    Insert(os,c.offset);
+    os<<" Target: ";
+    Insert(os,c.target);
+    os<<" Rotation: "<<c.rotation<<" Zoom="<<c.zoom;
+    os<<"\nCamera matrix\n";
+    Insert(os,GetCameraMatrix2D(c));
+    os<<"\n";
+}
+
+void Insert(std::ostream& os, const Camera3D& c) {
+    os<<"*** 3D Camera info. ***\nPosition: ";
+    Insert(os,c.position);
+    os<<" Target: ";
+    Insert(os,c.target);
+    os<<" Up vector: ";
+    Insert(os,c.up);
+    os<<"\n";
+    if (c.projection==CAMERA_PERSPECTIVE) {
+        os<<"Projection mode: perspective.  FOV="<<c.fovy<<" degrees\n";
+    }
+    if (c.projection==CAMERA_ORTHOGRAPHIC) {
+        os<<"Projection mode: orthographic. Near plane width="<<c.fovy<<"\n";
+    }
+    os<<"Camera matrix:\n";
+    Insert(os,GetCameraMatrix(c));
+    os<<"\n";
+}
+
+void Insert(std::ostream& os, const Ray& r) {
+    os<<"Ray position: ";
+    Insert(os,r.position);
+    os<<" Ray direction: ";
+    Insert(os,r.direction);
+}
+
+void Insert(std::ostream& os, const RayHitInfo& h) {
+    if (h.hit) {
+        os<<"Ray hit. Distance="<<h.distance<<" Position: ";
+        Insert(os,h.position);
+        os<<" Surface normal: ";
+        Insert(os,h.normal);
+    }
+    else {
+        os<<"Ray missed.";
+    }
+}
+
+void Insert(std::ostream& os, const BoundingBox& b) {
+    os<<"Bounding box coordinates.  Min: ";
+    Insert(os,b.min);
+    os<<" Max: ";
+    Insert(os,b.max);
+}
+
+void Insert(std::ostream& os, const NPatchInfo& n) {
+    os<<"NPatch info:  Rectangle: ";
+    Insert(os,n.source);
+    os<<" Border offsets: Left: "<<n.left<<" Right: "<<n.right<<" Top: "<<n.top<<" Bottom: "<<n.bottom<<" Layout: "<<n.layout;
+}
+
+void Insert(std::ostream& os, const CharInfo& c) { os<<"Char info:  Char value: "<<c.value<<" Offset X: "<<c.offsetX<<" Offset Y: "<<c.offsetY<<" Advance position X: "<<c.advanceX; }
+
+void Insert(std::ostream& os, const Font& f) {
+    os<<"Font info:  Base size (default char height): "<<f.baseSize<<" Number of characters: "<<f.charsCount<<" Padding around chars: "<<f.charsPadding;
+}
+
+//Random precision, float format, flags, base, adjustment, fill and field width, the same for both streams
+void RandomFormat(std::ostream& a, std::ostream& b) {
+    const std::ios_base::fmtflags floatFields[]={std::ios_base::fmtflags(0), std::ios_base::fixed, std::ios_base::scientific, std::ios_base::fixed|std::ios_base::scientific};
+    const std::ios_base::fmtflags adjustFields[]={std::ios_base::fmtflags(0), std::ios_base::left, std::ios_base::right, std::ios_base::internal};
+    const std::ios_base::fmtflags baseFields[]={std::ios_base::dec, std::ios_base::dec, std::ios_base::hex, std::ios_base::oct};
+    std::ios_base::fmtflags flags=floatFields[Rng()%4] | adjustFields[Rng()%4] | baseFields[Rng()%4];
+    if (Rng()%4==0) flags|=std::ios_base::showpos;
+    if (Rng()%4==0) flags|=std::ios_base::showpoint;
+    if (Rng()%4==0) flags|=std::ios_base::uppercase;
+    if (Rng()%4==0) flags|=std::ios_base::showbase;
+    std::streamsize precision=Rng()%12, width=(Rng()%3==0)?Rng()%40:0;
+    char fill=(Rng()%2)?' ':'*';
+    for (std::ostream* os : {&a, &b}) {
+        os->flags(flags);
+        os->precision(precision);
+        os->fill(fill);
+        os->width(width);
+    }
+}
+
+template<typename T> void FuzzOutput(const char* type, std::size_t cases) {
+    for (std::size_t i=0; i<cases; i++) {
+        T value=Random<T>();
+        std::ostringstream got, want;
+        RandomFormat(got,want);
+        got<<value<<"|"<<1.5f;  //The width applies to the value alone, not to what follows
+        Insert(want,value);
+        want<<"|"<<1.5f;
+        Expect(type,"operator<<",got.str(),want.str(),value);
+    }
+}
+
+// ********************************************
+//
+//    Parsing
+//
+// ********************************************
+
+//Parses text as a Rectangle from memory and from a stream, both of which must accept it exactly when valid
+void ExpectRectangle(const char* text, bool valid) {
+    Rectangle parsed{}, streamed{};
+    bool fromChars=RaylibOps::FromChars(text,text+std::strlen(text),parsed).ec==std::errc();
+    std::istringstream stream(text);
+    stream>>streamed;
+    Expect("Rectangle FromChars()",text,fromChars,valid);
+    Expect("Rectangle operator>>",text,!stream.fail(),valid);
+    if (!valid) return;
+    Expect("Rectangle FromChars()",text,parsed,Rectangle{1.0f,2.0f,3.0f,4.0f});
+    Expect("Rectangle operator>>",text,streamed,Rectangle{1.0f,2.0f,3.0f,4.0f});
+}
+
+//Whitespace may come between the parts of the text, but a label must match exactly, spaces included
+void ParseLabels() {
+    ExpectRectangle("Rectangle corner: (1,2), Width=3Height=4",true);
+    ExpectRectangle("  Rectangle corner:( 1 , 2 ) ,\tWidth= 3 Height=4",true);
+    ExpectRectangle("Rectanglecorner: (1,2), Width=3Height=4",false);
+    ExpectRectangle("Rectangle  corner: (1,2), Width=3Height=4",false);
+    ExpectRectangle("R e c t a n g l e corner: (1,2), Width=3Height=4",false);
+    ExpectRectangle("Rectangle corner : (1,2), Width=3Height=4",false);
+    ExpectRectangle("Rectangle corner: (1,2), Wid th=3Height=4",false);
+}
+
+//Random values printed with 9 significant digits or as hexfloats, either with showpos, must read back with operator>> and with FromChars() as the very same
+//bits, any NaN for a NaN, leaving at most the trailing newline of a Matrix.  All of their texts, separated by spaces and newlines, must read back whole
+//into a std::vector.
+template<typename T> void FuzzParse(const char* type, std::size_t cases) {
+    std::vector<T> values(cases/16+1);
+    std::string all;
+    for (T& value : values) {
+        value=Random<T>();
+        std::ostringstream os;
+        if (Rng()%2==0) os<<std::hexfloat;
+        else os<<std::setprecision(9);
+        if (Rng()%2==0) os<<std::showpos;
+        os<<value;
+        const std::string text=os.str();
+        T streamed{}, parsed{};
+        std::istringstream is(text);
+        is>>streamed;
+        std::from_chars_result r=RaylibOps::FromChars(text.data(),text.data()+text.size(),parsed);
+        Expect(type,"operator>> reads operator<<",!is.fail(),true,text);
+        Expect(type,"FromChars() reads operator<< to the end",r.ec==std::errc() && std::all_of(r.ptr,text.data()+text.size(),[](char c) { return std::isspace((unsigned char)c)!=0; }),true,text);
+        Expect(type,"operator>> of operator<<",streamed,value,text);
+        Expect(type,"FromChars() of operator<<",parsed,value,text);
+        all+=text+((Rng()%2==0)?" ":"\n");
+    }
+    std::vector<T> parsed;
+    std::from_chars_result r=RaylibOps::FromChars(all.data(),all.data()+all.size(),parsed);
+    Expect(type,"FromChars() into a std::vector",r.ec==std::errc() && parsed.size()==values.size(),true);
+    for (std::size_t i=0; i<parsed.size() && i<values.size(); i++) Expect(type,"FromChars() into a std::vector",parsed[i],values[i],values[i]);
+}
+
+// ********************************************
+//
+//    Binary serialization
+//
+// ********************************************
+
+bool SameCharInfo(const CharInfo& a, const CharInfo& b) {
+return a.value==b.value && a.offsetX==b.offsetX && a.offsetY==b.offsetY && a.advanceX==b.advanceX && a.image.data==b.image.data
+       && a.image.width==b.image.width && a.image.height==b.image.height && a.image.mipmaps==b.image.mipmaps && a.image.format==b.image.format;
+}
+
+//A CharInfo is written as its value, offsets and advance, then the width, height, mipmaps and format of its image without the pixels
+void BinaryLayout() {
+    static_assert(RaylibOps::BinarySize<CharInfo>()==32, "A CharInfo is eight 4-byte fields");
+    unsigned char pixels[4]={};
+    const CharInfo glyph{65, -2, 3, 0x01020304, Image{pixels, 16, 24, 1, 7}};
+    const unsigned char want[32]={65,0,0,0, 0xfe,0xff,0xff,0xff, 3,0,0,0, 4,3,2,1, 16,0,0,0, 24,0,0,0, 1,0,0,0, 7,0,0,0};
+    unsigned char bytes[32];
+    unsigned char* end=RaylibOps::EncodeBinary(bytes,glyph);
+    Expect("CharInfo","EncodeBinary() size",end==bytes+sizeof(bytes),true);
+    Expect("CharInfo","EncodeBinary() bytes",std::memcmp(bytes,want,sizeof(want))==0,true);
+    CharInfo read{};
+    RaylibOps::DecodeBinary(want,read);
+    CharInfo withoutPixels=glyph;
+    withoutPixels.image.data=nullptr;
+    Expect("CharInfo","DecodeBinary()",SameCharInfo(read,withoutPixels),true);
+
+    //Arrays of CharInfo go through the stream in chunks, arrays of Vector3 in one write
+    std::vector<CharInfo> glyphs(300);
+    for (std::size_t i=0; i<glyphs.size(); i++) glyphs[i]=CharInfo{(int)i, RandomInt(100), RandomInt(100), RandomInt(100), Image{nullptr, RandomInt(1000), RandomInt(1000), 1, 7}};
+    std::vector<Vector3> points=RandomVector<Vector3>(300);
+    std::stringstream stream;
+    RaylibOps::WriteBinary(stream,glyphs);
+    RaylibOps::WriteBinary(stream,points);
+    Expect("CharInfo","WriteBinary() size",stream.str().size()==300*(32+12),true);
+    std::vector<CharInfo> glyphsRead(glyphs.size());
+    std::vector<Vector3> pointsRead(points.size());
+    RaylibOps::ReadBinary(stream,glyphsRead);
+    RaylibOps::ReadBinary(stream,pointsRead);
+    Expect("CharInfo","ReadBinary() of an array",(bool)stream,true);
+    for (std::size_t i=0; i<glyphs.size(); i++) {
+        Expect("CharInfo","ReadBinary() of an array",SameCharInfo(glyphsRead[i],glyphs[i]),true);
+        Expect("Vector3","ReadBinary() of an array",pointsRead[i],points[i]);
+    }
+}
+
+// ********************************************
+//
+//    Regressions
+//
+// ********************************************
+
+void Regressions() {
+    //Every Color operator once wrote the alpha result into r.  Distinct channels show a channel landing in the wrong place.
+    const Color a{10,20,30,200}, b{1,2,3,4};
+    Expect("Color","channels of a+b",a+b,Color{11,22,33,204},a,b);
+    Expect("Color","channels of a-b",a-b,Color{9,18,27,196},a,b);
+    Expect("Color","channels of a*b",a*b,ReferenceColor(a,b,ReferenceMultiply),a,b);
+    Expect("Color","channels of a/b",a/b,ReferenceColor(a,b,ReferenceDivide),a,b);
+    Expect("Color","channels of a*s",a*0.5f,Color{5,10,15,100},a);
+    Expect("Color","channels of a/s",a/2.0f,Color{5,10,15,100},a);
+    Color c=Color{10,20,30,200}/Color{1,1,1,2};
+    Expect("Color","r of a/b",(unsigned int)c.r==ReferenceDivide(10,1),true,a);
+    Expect("Color","alpha of a/b",(unsigned int)c.a==ReferenceDivide(200,2),true,a);
+
+    //Unary minus once negated its operand in place and returned a reference to it
+    static_assert(!std::is_reference<decltype(-std::declval<Vector2&>())>::value && !std::is_reference<decltype(-std::declval<Vector3&>())>::value
+                  && !std::is_reference<decltype(-std::declval<Vector4&>())>::value && !std::is_reference<decltype(-std::declval<Vector3i&>())>::value,
+                  "Unary minus returns a new vector, not a reference to its operand");
+    Vector3 v{1.0f,-2.0f,3.0f};
+    Vector3 negated=-v;
+    Expect("Vector3","-v",negated,Vector3{-1.0f,2.0f,-3.0f},v);
+    Expect("Vector3","v after -v",v,Vector3{1.0f,-2.0f,3.0f});
+    Vector3 twice=-(-v);
+    Expect("Vector3","-(-v)",twice,v,v);
+    Vector3 zero=v+(-v);
+    Expect("Vector3","v+(-v)",zero,Vector3{0.0f,0.0f,0.0f},v);
+    const Vector2 constant{4.0f,-5.0f};
+    Vector2 negatedConstant=-constant, temporary=-Vector2{4.0f,-5.0f};
+    Expect("Vector2","-const",negatedConstant,Vector2{-4.0f,5.0f},constant);
+    Expect("Vector2","-temporary",temporary,Vector2{-4.0f,5.0f});
+    RaylibOps::Negate(v);
+    Expect("Vector3","Negate(v)",v,Vector3{-1.0f,2.0f,-3.0f});
+
+    //An infinite or NaN component once made HashGrid::FindEqual() probe about 2^63 cells along its axis
+    const float inf=std::numeric_limits<float>::infinity(), nan=std::numeric_limits<float>::quiet_NaN();
+    const Vector3 nonFinite[]={Vector3{inf,0.0f,0.0f}, Vector3{-inf,1.0f,2.0f}, Vector3{nan,0.0f,0.0f}, Vector3{1.0f,inf,nan}, Vector3{1e30f,-1e30f,0.0f}};
+    RaylibOps::HashGrid<Vector3,RaylibOps::UlpTolerance<4>> ulps(0.001f);
+    RaylibOps::HashGrid<Vector3,RaylibOps::RelativeTolerance<4>> relative(0.001f);
+    for (const Vector3& n : nonFinite) {
+        ulps.Insert(n);
+        relative.Insert(n);
+    }
+    for (std::size_t i=0; i<5; i++) {
+        bool hasNaN=(i==2 || i==3);
+        Expect("HashGrid","FindEqual() with 4 ulps of inf or NaN",ulps.FindEqual(nonFinite[i])==(hasNaN?ulps.npos:i),true,nonFinite[i]);
+        Expect("HashGrid","FindEqual() within 4 epsilons of inf or NaN",relative.FindEqual(nonFinite[i])==(i==4?i:relative.npos),true,nonFinite[i]);
+    }
+    const Vector2 withNaN[]={Vector2{inf,nan}, Vector2{nan,-inf}, Vector2{inf,nan}};
+    std::vector<std::size_t> remap;
+    std::vector<Vector2> welded=RaylibOps::Weld(withNaN,3,remap);
+    Expect("Vector2","Weld() of vectors with NaN",welded.size()==3 && remap[0]==0 && remap[1]==1 && remap[2]==2,true);
+
+    //Swapping lanes from an arena with lanes from the heap once kept each allocator, so the heap buffer was later handed to the arena to free
+    typedef std::vector<float, RaylibOps::AlignedAllocator<float> > Lane;
+    RaylibOps::FrameArena scratch(1<<16);
+    Lane heap(100,1.0f);
+    {
+        RaylibOps::FrameArena::Scope use(scratch);
+        Lane pooled(50,2.0f);
+        pooled.swap(heap);
+        Expect("AlignedAllocator","arena after swap",pooled.get_allocator().arena==nullptr && heap.get_allocator().arena==&scratch,true);
+        Expect("AlignedAllocator","buffers after swap",scratch.Owns(heap.data()) && !scratch.Owns(pooled.data()) && pooled.size()==100 && heap[49]==2.0f,true);
+    }
+    RaylibOps::Vector3Array fromHeap(std::vector<Vector3>(3,Vector3{1.0f,2.0f,3.0f}));
+    {
+        RaylibOps::FrameArena::Scope use(scratch);
+        RaylibOps::Vector3Array fromArena(std::vector<Vector3>(2,Vector3{4.0f,5.0f,6.0f}));
+        std::swap(fromHeap,fromArena);
+        Expect("Vector3Array","sizes after std::swap()",fromHeap.size()==2 && fromArena.size()==3,true);
+        Expect("Vector3Array","std::swap() into the heap's array",fromHeap[1],Vector3{4.0f,5.0f,6.0f});
+        Expect("Vector3Array","std::swap() into the arena's array",fromArena[2],Vector3{1.0f,2.0f,3.0f});
+    }
+}
+
+//Every division policy is constexpr, so dividing by a constant folds at compile time.  Instrumented operators count their calls and are not constexpr.
+#ifndef INSTRUMENT_OVERLOADS
+constexpr Vector2 Half=Vector2{1.0f,2.0f}/2.0f;
+static_assert(Half.x==0.5f && Half.y==1.0f && (Vector3i{4,8,-9}/2).z==-4, "operator/ is constexpr");
+#endif
+static_assert(RaylibOps::Divide(Vector3{1.0f,2.0f,4.0f},4.0f,RaylibOps::DivisionIEEE()).z==1.0f && RaylibOps::Divide(Vector4{1.0f,2.0f,4.0f,8.0f},2.0f,RaylibOps::DivisionReturnsZero()).w==4.0f
+              && RaylibOps::Divide(Vector2{1.0f,2.0f},2.0f,RaylibOps::DivisionAsserts()).y==1.0f && RaylibOps::Divide(Vector2i{4,8},0,RaylibOps::DivisionReturnsZero()).x==0,
+              "Each division policy is constexpr");
+
+//DIVISION_BY_ZERO_THROW, with which tests/CMakeLists.txt builds this file
+void DivisionByZero() {
+    ExpectThrows("Vector2","a/0",[] { Vector2 q=Vector2{1.0f,2.0f}/0.0f; (void)q; });
+    ExpectThrows("Vector3","a/=0",[] { Vector3 q{1.0f,2.0f,3.0f}; q/=0.0f; });
+    ExpectThrows("Vector4","a/0",[] { Vector4 q=Vector4{1.0f,2.0f,3.0f,4.0f}/0.0f; (void)q; });
+    ExpectThrows("Vector2i","a/0",[] { Vector2i q=Vector2i{1,2}/0; (void)q; });
+    ExpectThrows("Vector3Array","a/0",[] { RaylibOps::Vector3Array q(3); q/=0.0f; });
+}
+
+// ********************************************
+//
+//    Instrumentation
+//
+// ********************************************
+
+#ifdef INSTRUMENT_OVERLOADS
+bool AllZero(const std::uint64_t* counts) {
+return std::all_of(counts,counts+RaylibOps::Instrumentation::CounterCount,[](std::uint64_t n) { return n==0; });
+}
+
+//The calls of a worker thread which has exited stay in Snapshot(), and Reset() starts every count from zero
+void CountCalls() {
+    namespace Counting=RaylibOps::Instrumentation;
+    const int Add=(int)Counting::Counter::ColorAdd;  //Counted by every backend, unlike the vector operators of VECTOR_EXPRESSION_TEMPLATES
+    const std::uint64_t Calls=1000;
+    Counting::Reset();
+    Counting::CounterTotals t=Counting::Snapshot();
+    Expect("Instrumentation","calls after Reset()",AllZero(t.calls) && AllZero(t.samples) && AllZero(t.ticks),true);
+    volatile unsigned char sink=0;
+    std::thread worker([&sink] {
+        Color sum{0,0,0,0};
+        for (std::uint64_t i=0; i<Calls; i++) sum=sum+Color{1,(unsigned char)i,0,0};
+        sink=sum.r;
+    });
+    worker.join();
+    t=Counting::Snapshot();
+    Expect("Instrumentation","Color operator+ calls of an exited thread",t.calls[Add]==Calls,true);
+    t.calls[Add]=0;
+    Expect("Instrumentation","other calls of an exited thread",AllZero(t.calls),true);
+#ifdef INSTRUMENT_OVERLOADS_CYCLES
+    //The worker's counters started at zero, so it timed its calls 0, 64, 128...
+    Expect("Instrumentation","Color operator+ calls timed",t.samples[Add]==(Calls+Counting::CycleSampleInterval-1)/Counting::CycleSampleInterval,true);
+#else
+    Expect("Instrumentation","calls timed without INSTRUMENT_OVERLOADS_CYCLES",AllZero(t.samples) && AllZero(t.ticks),true);
+#endif
+    std::ostringstream os;
+    Counting::Report(os);
+    const std::string report=os.str();
+    Expect("Instrumentation","Report()",report.rfind("Color operator+: 1000 calls",0)==0 && std::count(report.begin(),report.end(),'\n')==1,true,report);
+    Counting::Reset();
+    t=Counting::Snapshot();
+    Expect("Instrumentation","calls of an exited thread after Reset()",AllZero(t.calls) && AllZero(t.samples) && AllZero(t.ticks),true);
+    Color c{sink,1,2,3};
+    sink=(c+c).g;
+    t=Counting::Snapshot();
+    Expect("Instrumentation","Color operator+ calls after Reset()",t.calls[Add]==1,true);
+}
+#endif
+
+// ********************************************
+//
+//    Throughput
+//
+// ********************************************
+
+volatile const void* Escaped;  //Storing the results' address here keeps the timed loops from being optimized away
+
+//The fastest of several runs of run(), in nanoseconds per element
+template<typename Run> double Nanoseconds(std::size_t n, Run run) {
+    double best=std::numeric_limits<double>::infinity();
+    for (int repeat=0; repeat<20; repeat++) {
+        auto start=std::chrono::steady_clock::now();
+        run();
+        std::chrono::duration<double, std::nano> elapsed=std::chrono::steady_clock::now()-start;
+        best=std::min(best,elapsed.count()/n);
+    }
+return best;
+}
+
+void Row(const char* name, double overloads, const char* referenceName, double reference) {
+    std::printf("  %-26s %8.2f    %-18s %8.2f\n",name,overloads,referenceName,reference);
+}
+
+void Throughput() {
+    const std::size_t n=4096;
+    std::vector<Vector3> a=ModerateVector<Vector3>(n), b=ModerateVector<Vector3>(n), out(n);
+    std::vector<Matrix> ma=ModerateVector<Matrix>(n/16), mb=ModerateVector<Matrix>(n/16), mout(n/16);
+    std::vector<Color> ca=RandomVector<Color>(n), cb=RandomVector<Color>(n), cout(n);
+    const RaylibOps::Vector3Array la(a), lb(b);
+    RaylibOps::Vector3Array lout(n);
+    const Matrix m=MatrixIdentity();
+    const float s=1.5f;
+
+    std::printf("Throughput of the %s backend, ns per element:\n",RaylibOps::Simd::BackendName);
+    Row("Vector3 a+b",Nanoseconds(n,[&] { for (std::size_t i=0; i<n; i++) out[i]=a[i]+b[i]; Escaped=out.data(); }),
+        "Vector3Add",Nanoseconds(n,[&] { for (std::size_t i=0; i<n; i++) out[i]=Vector3Add(a[i],b[i]); Escaped=out.data(); }));
+    Row("Vector3 a*s",Nanoseconds(n,[&] { for (std::size_t i=0; i<n; i++) out[i]=a[i]*s; Escaped=out.data(); }),
+        "Vector3Scale",Nanoseconds(n,[&] { for (std::size_t i=0; i<n; i++) out[i]=Vector3Scale(a[i],s); Escaped=out.data(); }));
+    Row("Vector3 a/s",Nanoseconds(n,[&] { for (std::size_t i=0; i<n; i++) out[i]=a[i]/s; Escaped=out.data(); }),
+        "Vector3Scale(1/s)",Nanoseconds(n,[&] { for (std::size_t i=0; i<n; i++) out[i]=Vector3Scale(a[i],1.0f/s); Escaped=out.data(); }));
+    Row("Vector3 s*a-(b+a)",Nanoseconds(n,[&] { for (std::size_t i=0; i<n; i++) out[i]=s*a[i]-(b[i]+a[i]); Escaped=out.data(); }),
+        "raymath",Nanoseconds(n,[&] { for (std::size_t i=0; i<n; i++) out[i]=Vector3Subtract(Vector3Scale(a[i],s),Vector3Add(b[i],a[i])); Escaped=out.data(); }));
+    Row("Matrix a*b",Nanoseconds(n/16,[&] { for (std::size_t i=0; i<n/16; i++) mout[i]=ma[i]*mb[i]; Escaped=mout.data(); }),
+        "MatrixMultiply",Nanoseconds(n/16,[&] { for (std::size_t i=0; i<n/16; i++) mout[i]=MatrixMultiply(ma[i],mb[i]); Escaped=mout.data(); }));
+    Row("Matrix m*v",Nanoseconds(n,[&] { for (std::size_t i=0; i<n; i++) out[i]=m*a[i]; Escaped=out.data(); }),
+        "Vector3Transform",Nanoseconds(n,[&] { for (std::size_t i=0; i<n; i++) out[i]=Vector3Transform(a[i],m); Escaped=out.data(); }));
+    Row("TransformPoints",Nanoseconds(n,[&] { RaylibOps::TransformPoints(m,a.data(),out.data(),n); Escaped=out.data(); }),
+        "Vector3Transform",Nanoseconds(n,[&] { for (std::size_t i=0; i<n; i++) out[i]=Vector3Transform(a[i],m); Escaped=out.data(); }));
+    Row("Vector3Array a+b",Nanoseconds(n,[&] { lout=la+lb; Escaped=lout.Lane(0); }),
+        "Vector3Add",Nanoseconds(n,[&] { for (std::size_t i=0; i<n; i++) out[i]=Vector3Add(a[i],b[i]); Escaped=out.data(); }));
+    Row("Color a*b",Nanoseconds(n,[&] { for (std::size_t i=0; i<n; i++) cout[i]=ca[i]*cb[i]; Escaped=cout.data(); }),
+        "written out",Nanoseconds(n,[&] { for (std::size_t i=0; i<n; i++) cout[i]=ReferenceColor(ca[i],cb[i],ReferenceMultiply); Escaped=cout.data(); }));
+    Row("ColorSpan *=",Nanoseconds(n,[&] { cout=ca; RaylibOps::ColorSpan(cout.data(),n)*=RaylibOps::ColorSpan(cb.data(),n); Escaped=cout.data(); }),
+        "written out",Nanoseconds(n,[&] { for (std::size_t i=0; i<n; i++) cout[i]=ReferenceColor(ca[i],cb[i],ReferenceMultiply); Escaped=cout.data(); }));
+
+    std::ostringstream text;
+    char buffer[64];
+    Row("Vector3 operator<<",Nanoseconds(n/16,[&] { text.str(""); for (std::size_t i=0; i<n/16; i++) text<<a[i]; Escaped=&text; }),
+        "snprintf",Nanoseconds(n/16,[&] { for (std::size_t i=0; i<n/16; i++) std::snprintf(buffer,sizeof buffer,"(%g,%g,%g)",a[i].x,a[i].y,a[i].z); Escaped=buffer; }));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::size_t cases=(argc>1)?(std::size_t)std::strtoull(argv[1],nullptr,10):20000;
+    std::printf("Fuzzing %zu cases per operator with the %s backend%s%s%s\n",cases,RaylibOps::Simd::BackendName,
+                RaylibOps::VectorExpressionTemplates?", VECTOR_EXPRESSION_TEMPLATES":"",
+#ifdef INLINE_OVERLOADS
+                ", INLINE_OVERLOADS",
+#else
+                "",
+#endif
+#ifdef COLOR_MODULATE_NORMALIZED
+                ", COLOR_MODULATE_NORMALIZED");
+#else
+                "");
+#endif
+
+    FuzzVector<Vector2>("Vector2",cases);
+    FuzzVector<Vector3>("Vector3",cases);
+    FuzzVector<Vector4>("Vector4",cases);
+    FuzzVector<Vector2i>("Vector2i",cases);
+    FuzzVector<Vector3i>("Vector3i",cases);
+    FuzzMatrix(cases/4);
+    FuzzColor(cases);
+    FuzzRectangle(cases);
+    FuzzBoundingBox(cases);
+
+    FuzzEquality<Vector2>("Vector2",cases);
+    FuzzEquality<Vector3>("Vector3",cases);
+    FuzzEquality<Vector4>("Vector4",cases);
+    FuzzEqualityMask<Vector2>("Vector2Array",cases);
+    FuzzEqualityMask<Vector3>("Vector3Array",cases);
+
+    FuzzVectorArray<Vector2>("Vector2Array",cases);
+    FuzzVectorArray<Vector3>("Vector3Array",cases);
+    FuzzTransformPoints(cases);
+    FuzzNlerpQuats(cases);
+    FuzzColorSpan(cases);
+    FuzzImages();
+    FuzzWeld<Vector2,RaylibOps::DefaultTolerance>("Vector2",cases);
+    FuzzWeld<Vector3,RaylibOps::DefaultTolerance>("Vector3",cases);
+    FuzzWeld<Vector3,RaylibOps::UlpTolerance<4>>("Vector3 within 4 ulps",cases);
+    FuzzWeld<Vector3,RaylibOps::RelativeTolerance<4>>("Vector3 within 4 epsilons",cases);
+    FuzzReductions();
+    FuzzLinearColor(cases);
+    FuzzCastRays(cases);
+    FuzzOverlapMask();
+    FuzzCameraSnapshot(cases);
+    FuzzAsyncLog(cases);
+
+    FuzzOutput<Vector2>("Vector2",cases/10);
+    FuzzOutput<Vector3>("Vector3",cases/10);
+    FuzzOutput<Vector4>("Vector4",cases/10);
+    FuzzOutput<Color>("Color",cases/10);
+    FuzzOutput<Matrix>("Matrix",cases/40);
+    FuzzOutput<Rectangle>("Rectangle",cases/10);
+    FuzzOutput<Image>("Image",cases/10);
+    FuzzOutput<Texture>("Texture",cases/10);
+    FuzzOutput<Camera2D>("Camera2D",cases/40);
+    FuzzOutput<Camera3D>("Camera3D",cases/40);
+    FuzzOutput<Ray>("Ray",cases/10);
+    FuzzOutput<RayHitInfo>("RayHitInfo",cases/10);
+    FuzzOutput<BoundingBox>("BoundingBox",cases/10);
+    FuzzOutput<NPatchInfo>("NPatchInfo",cases/10);
+    FuzzOutput<CharInfo>("CharInfo",cases/10);
+    FuzzOutput<Font>("Font",cases/10);
+
+    ParseLabels();
+    FuzzParse<Vector2>("Vector2",cases);
+    FuzzParse<Vector3>("Vector3",cases);
+    FuzzParse<Vector4>("Vector4",cases);
+    FuzzParse<Color>("Color",cases);
+    FuzzParse<Matrix>("Matrix",cases/4);
+    FuzzParse<Rectangle>("Rectangle",cases);
+    BinaryLayout();
+    Regressions();
+    DivisionByZero();
+#ifdef INSTRUMENT_OVERLOADS
+    CountCalls();
+#endif
+
+    if (Failures>0) {
+        std::printf("%zu mismatches\n",Failures);
+        return EXIT_FAILURE;
+    }
+    std::printf("Every result matches its reference\n");
+    Throughput();
+return EXIT_SUCCESS;
+}